@@ -0,0 +1,51 @@
+// Copyleft 2026 Chris Korda
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation; either version 2 of the License, or any later version.
+/*
+		chris korda
+ 
+		revision history:
+		rev		date	comments
+		00		17oct26	initial version
+
+*/
+
+// this table is generated by MakeAliasTable in SetConsonance.cpp; don't edit it
+
+#define PCS_ALIAS_COUNT 82
+
+static const ALIAS_TABLE m_tblAlias = {
+	{
+		-1, -1, -1, -1, -1, -1, -1, -1, 0, 1, 2, 3, 4, 5, 6, 7,
+		8, 9, 10, -1, -1, 11, -1, -1, -1, 12, 13, 14, 15, 16, 17, 18,
+		19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, 35, -1, 36, -1, -1, -1, -1,
+		37, 38, -1, 39, -1, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50,
+		51, 52, 53, 54, 55, 56, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		57, -1, -1, -1, -1, 58, -1, 59, -1, 60, -1, 61, -1, 62, 63, -1,
+		64, 71, 65, 66, 67, 68, 69, 70, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 73, -1,
+		74, -1, -1, -1, -1, -1, -1, -1, 75, 76, 77, 78, 79, 80, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 81, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	},
+	{
+		-1, -1, -1, -1, -1, -1, -1, -1, 1, 2, 0, 2, 0, 1, 2, 1,
+		2, 0, 2, -1, -1, 2, -1, -1, -1, 2, 2, 2, 2, 2, 2, 2,
+		1, 2, 2, 2, 2, 2, 2, 0, 2, 1, 1, 2, 2, 0, 2, 2,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, 2, -1, 2, -1, -1, -1, -1,
+		2, 2, -1, 2, -1, 2, 0, 2, 2, 1, 0, 2, 2, 0, 2, 2,
+		2, 2, 2, 2, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		2, -1, -1, -1, -1, 2, -1, 1, -1, 0, -1, 0, -1, 2, 1, -1,
+		2, 2, 2, 1, 0, 0, 2, 2, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+		-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+	},
+};
@@ -12,6 +12,7 @@
 		02		03apr15	add serialization
 		03		17jan23	add get data methods
 		04		26jul24	add equality operators
+		05		17oct26	add sorting network and vectorized search
  
 		dynamic array with a fixed maximum size
  
@@ -20,9 +21,31 @@
 #ifndef CBOUND_ARRAY
 #define	CBOUND_ARRAY
 
+#include <algorithm>
+#include <functional>
+#include <type_traits>
+#if defined(_M_IX86) || defined(_M_X64) || defined(__SSE2__)
+#include <emmintrin.h>
+#define BOUND_ARRAY_SSE2	// use SSE2 for searching arrays of integers
+#endif
+
+// Sorting, searching and comparing avoid indirect calls. Arrays that can't
+// be larger than SORT_NETWORK_MAX are sorted with Batcher's merge exchange
+// network, which is a fixed sequence of branchless compare-exchanges for a
+// given size; larger arrays use std::sort. Arrays of int or BYTE are
+// searched and compared with SSE2 if it's available, provided that they can
+// hold at least one vector. Both choices are made at compile time by tag
+// dispatch on MAX_SIZE, so that unused versions are never instantiated.
+
 template<class TYPE, int MAX_SIZE>
 class CBoundArray {
 public:
+// Constants
+	enum {
+		SORT_NETWORK_MAX = 16,	// largest maximum size that uses a sorting network
+		VECTOR_BYTES = 16,		// size of a vector, in bytes
+	};
+
 // Construction
 	CBoundArray();
 	CBoundArray(const CBoundArray& arr);
@@ -63,16 +86,161 @@ public:
 	void	Mid(CBoundArray& arr, int nFirst, int nCount) const;
 
 protected:
+// Types
+	typedef std::integral_constant<bool, (MAX_SIZE <= SORT_NETWORK_MAX)> SORT_NETWORK_TAG;	// true if sorting network
+	typedef std::integral_constant<bool, (MAX_SIZE * sizeof(TYPE) >= VECTOR_BYTES)> VECTOR_TAG;	// true if vectorizable
+
 // Data members
 	int		m_Size;				// number of elements
 	TYPE	m_Data[MAX_SIZE];	// array of elements
 
 // Helpers
 	static	void	CopyElements(TYPE *pDest, const TYPE *pSrc, int nCount);
-	static	int		SortCompareAscending(const void *elem1, const void *elem2);
-	static	int		SortCompareDescending(const void *elem1, const void *elem2);
+	static	void	CompareExchange(TYPE& a, TYPE& b, bool Descending);
+	static	void	SortNetwork(TYPE *pData, int nElems, bool Descending);
+	void	SortImpl(bool Descending, std::true_type);
+	void	SortImpl(bool Descending, std::false_type);
+	int		FindImpl(TYPE Target, int iStart, std::true_type) const;
+	int		FindImpl(TYPE Target, int iStart, std::false_type) const;
+	int		ReverseFindImpl(TYPE Target, std::true_type) const;
+	int		ReverseFindImpl(TYPE Target, std::false_type) const;
+	bool	EqualImpl(const CBoundArray& arr, std::true_type) const;
+	bool	EqualImpl(const CBoundArray& arr, std::false_type) const;
 };
 
+// Search helpers are overloaded for the element types that can be vectorized;
+// other types, and arrays too small to hold a vector, use the generic versions,
+// which are plain loops.
+
+template<class TYPE>
+inline int BoundArrayFind(const TYPE *pData, int iStart, int nElems, TYPE Target)
+{
+	for (int iElem = iStart; iElem < nElems; iElem++) {
+		if (pData[iElem] == Target)
+			return(iElem);
+	}
+	return(-1);
+}
+
+template<class TYPE>
+inline int BoundArrayReverseFind(const TYPE *pData, int nElems, TYPE Target)
+{
+	for (int iElem = nElems - 1; iElem >= 0; iElem--) {
+		if (pData[iElem] == Target)
+			return(iElem);
+	}
+	return(-1);
+}
+
+template<class TYPE>
+inline bool BoundArrayEqual(const TYPE *pData1, const TYPE *pData2, int nElems)
+{
+	for (int iElem = 0; iElem < nElems; iElem++) {
+		if (pData1[iElem] != pData2[iElem])
+			return false;
+	}
+	return true;
+}
+
+#ifdef BOUND_ARRAY_SSE2
+
+// Each vector holds 4 ints or 16 BYTEs. Comparison results are reduced to
+// a bit per byte with movemask, so a matching int sets four bits. Only whole
+// vectors within the array are loaded, and leftover elements are done with
+// the generic versions.
+
+inline int BoundArrayFirstBit(int nBits)
+{
+	int	iBit = 0;
+	while (!(nBits & (1 << iBit)))
+		iBit++;
+	return iBit;
+}
+
+inline int BoundArrayLastBit(int nBits)
+{
+	int	iBit = 15;
+	while (!(nBits & (1 << iBit)))
+		iBit--;
+	return iBit;
+}
+
+inline int BoundArrayFind(const int *pData, int iStart, int nElems, int Target)
+{
+	__m128i	vTarget = _mm_set1_epi32(Target);
+	int	iElem = iStart;
+	for (; iElem + 4 <= nElems; iElem += 4) {
+		__m128i	v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pData + iElem));
+		int	nMatch = _mm_movemask_epi8(_mm_cmpeq_epi32(v, vTarget));
+		if (nMatch)
+			return iElem + BoundArrayFirstBit(nMatch) / 4;
+	}
+	return BoundArrayFind<int>(pData, iElem, nElems, Target);
+}
+
+inline int BoundArrayFind(const BYTE *pData, int iStart, int nElems, BYTE Target)
+{
+	__m128i	vTarget = _mm_set1_epi8(static_cast<char>(Target));
+	int	iElem = iStart;
+	for (; iElem + 16 <= nElems; iElem += 16) {
+		__m128i	v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pData + iElem));
+		int	nMatch = _mm_movemask_epi8(_mm_cmpeq_epi8(v, vTarget));
+		if (nMatch)
+			return iElem + BoundArrayFirstBit(nMatch);
+	}
+	return BoundArrayFind<BYTE>(pData, iElem, nElems, Target);
+}
+
+inline int BoundArrayReverseFind(const int *pData, int nElems, int Target)
+{
+	__m128i	vTarget = _mm_set1_epi32(Target);
+	int	nLeft = nElems;
+	for (; nLeft >= 4; nLeft -= 4) {
+		__m128i	v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pData + nLeft - 4));
+		int	nMatch = _mm_movemask_epi8(_mm_cmpeq_epi32(v, vTarget));
+		if (nMatch)
+			return nLeft - 4 + BoundArrayLastBit(nMatch) / 4;
+	}
+	return BoundArrayReverseFind<int>(pData, nLeft, Target);
+}
+
+inline int BoundArrayReverseFind(const BYTE *pData, int nElems, BYTE Target)
+{
+	__m128i	vTarget = _mm_set1_epi8(static_cast<char>(Target));
+	int	nLeft = nElems;
+	for (; nLeft >= 16; nLeft -= 16) {
+		__m128i	v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pData + nLeft - 16));
+		int	nMatch = _mm_movemask_epi8(_mm_cmpeq_epi8(v, vTarget));
+		if (nMatch)
+			return nLeft - 16 + BoundArrayLastBit(nMatch);
+	}
+	return BoundArrayReverseFind<BYTE>(pData, nLeft, Target);
+}
+
+inline bool BoundArrayEqualVec(const BYTE *pData1, const BYTE *pData2, int nBytes)
+{
+	int	iByte = 0;
+	for (; iByte + 16 <= nBytes; iByte += 16) {
+		__m128i	v1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pData1 + iByte));
+		__m128i	v2 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pData2 + iByte));
+		if (_mm_movemask_epi8(_mm_cmpeq_epi8(v1, v2)) != 0xffff)
+			return false;
+	}
+	return BoundArrayEqual<BYTE>(pData1 + iByte, pData2 + iByte, nBytes - iByte);
+}
+
+inline bool BoundArrayEqual(const int *pData1, const int *pData2, int nElems)
+{
+	return BoundArrayEqualVec(reinterpret_cast<const BYTE *>(pData1), reinterpret_cast<const BYTE *>(pData2), nElems * 4);
+}
+
+inline bool BoundArrayEqual(const BYTE *pData1, const BYTE *pData2, int nElems)
+{
+	return BoundArrayEqualVec(pData1, pData2, nElems);
+}
+
+#endif
+
 template<class TYPE, int MAX_SIZE>
 inline CBoundArray<TYPE, MAX_SIZE>::CBoundArray()
 {
@@ -253,49 +421,102 @@ inline void CBoundArray<TYPE, MAX_SIZE>::RemoveAll()
 	m_Size = 0;
 }
 
+template<class TYPE, int MAX_SIZE>
+inline int CBoundArray<TYPE, MAX_SIZE>::FindImpl(TYPE Target, int iStart, std::true_type) const
+{
+	return BoundArrayFind(m_Data, iStart, m_Size, Target);	// vectorized overload if any
+}
+
+template<class TYPE, int MAX_SIZE>
+inline int CBoundArray<TYPE, MAX_SIZE>::FindImpl(TYPE Target, int iStart, std::false_type) const
+{
+	return BoundArrayFind<TYPE>(m_Data, iStart, m_Size, Target);	// generic version
+}
+
 template<class TYPE, int MAX_SIZE>
 inline int CBoundArray<TYPE, MAX_SIZE>::Find(TYPE Target, int iStart) const
 {
 	ASSERT(iStart >= 0 && iStart <= m_Size);
-	int	nElems = m_Size;
-	for (int iElem = iStart; iElem < nElems; iElem++) {
-		if (m_Data[iElem] == Target)
-			return(iElem);
-	}
-	return(-1);
+	return FindImpl(Target, iStart, VECTOR_TAG());
+}
+
+template<class TYPE, int MAX_SIZE>
+inline int CBoundArray<TYPE, MAX_SIZE>::ReverseFindImpl(TYPE Target, std::true_type) const
+{
+	return BoundArrayReverseFind(m_Data, m_Size, Target);	// vectorized overload if any
+}
+
+template<class TYPE, int MAX_SIZE>
+inline int CBoundArray<TYPE, MAX_SIZE>::ReverseFindImpl(TYPE Target, std::false_type) const
+{
+	return BoundArrayReverseFind<TYPE>(m_Data, m_Size, Target);	// generic version
 }
 
 template<class TYPE, int MAX_SIZE>
 inline int CBoundArray<TYPE, MAX_SIZE>::ReverseFind(TYPE Target) const
 {
-	for (int iElem = m_Size - 1; iElem >= 0; iElem--) {
-		if (m_Data[iElem] == Target)
-			return(iElem);
+	return ReverseFindImpl(Target, VECTOR_TAG());
+}
+
+template<class TYPE, int MAX_SIZE>
+inline void CBoundArray<TYPE, MAX_SIZE>::CompareExchange(TYPE& a, TYPE& b, bool Descending)
+{
+	// conditional moves rather than branches, for simple types
+	TYPE	x = a;
+	TYPE	y = b;
+	bool	bSwap = Descending ? x < y : y < x;
+	a = bSwap ? y : x;
+	b = bSwap ? x : y;
+}
+
+template<class TYPE, int MAX_SIZE>
+inline void CBoundArray<TYPE, MAX_SIZE>::SortNetwork(TYPE *pData, int nElems, bool Descending)
+{
+	// Batcher's merge exchange, from Knuth TAOCP vol. 3, 5.2.2 algorithm M;
+	// the comparisons depend only on the number of elements, not on the data
+	if (nElems < 2)
+		return;
+	int	t = 0;
+	while ((1 << t) < nElems)
+		t++;
+	for (int p = 1 << (t - 1); p > 0; p >>= 1) {
+		int	q = 1 << (t - 1);
+		int	r = 0;
+		int	d = p;
+		for (;;) {
+			int	nPairs = nElems - d;
+			for (int i = 0; i < nPairs; i++) {
+				if ((i & p) == r)
+					CompareExchange(pData[i], pData[i + d], Descending);
+			}
+			if (q == p)
+				break;
+			d = q - p;
+			q >>= 1;
+			r = p;
+		}
 	}
-	return(-1);
 }
 
 template<class TYPE, int MAX_SIZE>
-int CBoundArray<TYPE, MAX_SIZE>::SortCompareAscending(const void *elem1, const void *elem2)
+inline void CBoundArray<TYPE, MAX_SIZE>::SortImpl(bool Descending, std::true_type)
 {
-	const TYPE	*a = (const TYPE *)elem1;
-	const TYPE	*b = (const TYPE *)elem2;
-	return(*a < *b ? -1 : (*a > *b ? 1 : 0));
+	SortNetwork(m_Data, m_Size, Descending);
 }
 
 template<class TYPE, int MAX_SIZE>
-int CBoundArray<TYPE, MAX_SIZE>::SortCompareDescending(const void *elem1, const void *elem2)
+inline void CBoundArray<TYPE, MAX_SIZE>::SortImpl(bool Descending, std::false_type)
 {
-	const TYPE	*a = (const TYPE *)elem1;
-	const TYPE	*b = (const TYPE *)elem2;
-	return(*a < *b ? 1 : (*a > *b ? -1 : 0));
+	if (Descending)
+		std::sort(m_Data, m_Data + m_Size, std::greater<TYPE>());
+	else
+		std::sort(m_Data, m_Data + m_Size, std::less<TYPE>());
 }
 
 template<class TYPE, int MAX_SIZE>
 inline void CBoundArray<TYPE, MAX_SIZE>::Sort(bool Descending)
 {
-	qsort(m_Data, m_Size, sizeof(TYPE), 
-		Descending ? SortCompareDescending : SortCompareAscending);
+	SortImpl(Descending, SORT_NETWORK_TAG());
 }
 
 template<class TYPE, int MAX_SIZE>
@@ -346,16 +567,24 @@ inline void CBoundArray<TYPE, MAX_SIZE>::Mid(CBoundArray& arr, int nFirst, int n
 	CopyElements(arr.m_Data, m_Data + nFirst, nCount);
 }
 
+template<class TYPE, int MAX_SIZE>
+inline bool CBoundArray<TYPE, MAX_SIZE>::EqualImpl(const CBoundArray& arr, std::true_type) const
+{
+	return BoundArrayEqual(m_Data, arr.m_Data, m_Size);	// vectorized overload if any
+}
+
+template<class TYPE, int MAX_SIZE>
+inline bool CBoundArray<TYPE, MAX_SIZE>::EqualImpl(const CBoundArray& arr, std::false_type) const
+{
+	return BoundArrayEqual<TYPE>(m_Data, arr.m_Data, m_Size);	// generic version
+}
+
 template<class TYPE, int MAX_SIZE>
 inline bool CBoundArray<TYPE, MAX_SIZE>::operator==(const CBoundArray& arr) const
 {
 	if (arr.GetSize() != m_Size)
 		return false;
-	for (int iElem = 0; iElem < m_Size; iElem++) {
-		if (arr[iElem] != GetAt(iElem))
-			return false;
-	}
-	return true;
+	return EqualImpl(arr, VECTOR_TAG());
 }
 
 template<class TYPE, int MAX_SIZE>
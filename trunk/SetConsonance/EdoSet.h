@@ -0,0 +1,321 @@
+// Copyleft 2026 Chris Korda
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation; either version 2 of the License, or any later version.
+/*
+		chris korda
+
+		revision history:
+		rev		date	comments
+		00		17oct26	initial version
+
+		pitch class sets in any equal division of the octave
+
+*/
+
+#pragma once
+
+#include "stdint.h"
+#include <atomic>
+
+// CEdoMask generalizes CPitchClassSet's mask operations to any number of
+// divisions of the octave from 2 to 32. A set is a mask in which bit N is
+// set if the set contains pitch class N. Set classes are canonicalized as
+// necklaces: the canonical rotation of a mask is the rotation that starts
+// at the lexicographically greatest bit string read upward from pitch class
+// zero, found in linear time by the two-pointer minimal rotation method.
+// The prime form is the greater of the canonical rotations of the mask and
+// of its inversion. The prime forms differ from Rahn's, but the partition
+// into set classes is the same, so for 12 divisions each prime form here
+// corresponds to exactly one of CPitchClassSet's prime forms.
+
+template<int DIVISIONS>
+class CEdoMask {
+public:
+// Types
+	typedef uint32_t MASK;
+	struct CLASSIFY {	// result of classifying a mask
+		MASK	nPrime;		// prime form
+		int		nTranspose;	// transposition that maps prime form onto mask
+		bool	bInverted;	// true if prime form must be inverted first
+	};
+	enum {
+		INTERVALS = DIVISIONS / 2,	// number of interval classes
+	};
+
+// Attributes
+	static	MASK	GetMaskAll();
+	static	int		CountBits(MASK nMask);
+	static	void	GetIntervalVector(MASK nMask, int *pVec);
+
+// Operations
+	static	MASK	Rotate(MASK nMask, int nTranspose);
+	static	MASK	Invert(MASK nMask);
+	static	int		FindCanonicalRotation(MASK nMask);
+	static	MASK	Canonicalize(MASK nMask);
+	static	bool	IsGreater(MASK nMask1, MASK nMask2);
+	static	CLASSIFY	Classify(MASK nMask);
+};
+
+template<int DIVISIONS>
+inline typename CEdoMask<DIVISIONS>::MASK CEdoMask<DIVISIONS>::GetMaskAll()
+{
+	static_assert(DIVISIONS >= 2 && DIVISIONS <= 32, "unsupported number of divisions");
+	return static_cast<MASK>((static_cast<uint64_t>(1) << DIVISIONS) - 1);
+}
+
+template<int DIVISIONS>
+inline int CEdoMask<DIVISIONS>::CountBits(MASK nMask)
+{
+	uint32_t	x = nMask;
+	x = x - ((x >> 1) & 0x55555555);
+	x = (x & 0x33333333) + ((x >> 2) & 0x33333333);
+	x = (x + (x >> 4)) & 0x0f0f0f0f;
+	return static_cast<int>((x * 0x01010101) >> 24);
+}
+
+template<int DIVISIONS>
+inline void CEdoMask<DIVISIONS>::GetIntervalVector(MASK nMask, int *pVec)
+{
+	// pVec receives INTERVALS elements; see CPitchClassSet::GetIntervalVector
+	for (int iInt = 0; iInt < INTERVALS; iInt++) {
+		int	nCount = CountBits(nMask & Rotate(nMask, iInt + 1));
+		if ((iInt + 1) * 2 == DIVISIONS)	// if interval is its own complement
+			nCount /= 2;
+		pVec[iInt] = nCount;
+	}
+}
+
+template<int DIVISIONS>
+inline typename CEdoMask<DIVISIONS>::MASK CEdoMask<DIVISIONS>::Rotate(MASK nMask, int nTranspose)
+{
+	// transpose upward; assume transposition is from 0 to DIVISIONS - 1
+	ASSERT(nTranspose >= 0 && nTranspose < DIVISIONS);
+	if (!nTranspose)	// avoid shifting by word size
+		return nMask;
+	return ((nMask << nTranspose) | (nMask >> (DIVISIONS - nTranspose))) & GetMaskAll();
+}
+
+template<int DIVISIONS>
+inline typename CEdoMask<DIVISIONS>::MASK CEdoMask<DIVISIONS>::Invert(MASK nMask)
+{
+	// invert around zero, same as mapping each pitch class N to (DIVISIONS - N) % DIVISIONS
+	uint32_t	x = nMask;
+	x = ((x & 0x55555555) << 1) | ((x >> 1) & 0x55555555);	// reverse 32 bits
+	x = ((x & 0x33333333) << 2) | ((x >> 2) & 0x33333333);
+	x = ((x & 0x0f0f0f0f) << 4) | ((x >> 4) & 0x0f0f0f0f);
+	x = ((x & 0x00ff00ff) << 8) | ((x >> 8) & 0x00ff00ff);
+	x = (x << 16) | (x >> 16);
+	x >>= 32 - DIVISIONS;	// pitch class N is now at DIVISIONS - 1 - N
+	return Rotate(static_cast<MASK>(x), 1);
+}
+
+template<int DIVISIONS>
+inline int CEdoMask<DIVISIONS>::FindCanonicalRotation(MASK nMask)
+{
+	// returns lowest pitch class at which canonical rotation starts; two
+	// candidate starts are compared until they differ, and the loser's start
+	// skips past the compared span, so the loop runs at most 3N times
+	int	i = 0;
+	int	j = 1;
+	int	k = 0;
+	while (i < DIVISIONS && j < DIVISIONS && k < DIVISIONS) {
+		int	iBit = i + k;
+		int	jBit = j + k;
+		if (iBit >= DIVISIONS)
+			iBit -= DIVISIONS;
+		if (jBit >= DIVISIONS)
+			jBit -= DIVISIONS;
+		int	a = (nMask >> iBit) & 1;
+		int	b = (nMask >> jBit) & 1;
+		if (a == b) {
+			k++;
+		} else {
+			if (a < b)	// greater bit string wins
+				i += k + 1;
+			else
+				j += k + 1;
+			if (i == j)
+				j++;
+			k = 0;
+		}
+	}
+	return i < j ? i : j;
+}
+
+template<int DIVISIONS>
+inline typename CEdoMask<DIVISIONS>::MASK CEdoMask<DIVISIONS>::Canonicalize(MASK nMask)
+{
+	int	nStart = FindCanonicalRotation(nMask);
+	return Rotate(nMask, (DIVISIONS - nStart) % DIVISIONS);	// move start to pitch class zero
+}
+
+template<int DIVISIONS>
+inline bool CEdoMask<DIVISIONS>::IsGreater(MASK nMask1, MASK nMask2)
+{
+	// compares bit strings read upward from pitch class zero
+	MASK	nDiff = nMask1 ^ nMask2;
+	return (nMask1 & nDiff & (0 - nDiff)) != 0;	// lowest differing bit decides
+}
+
+template<int DIVISIONS>
+inline typename CEdoMask<DIVISIONS>::CLASSIFY CEdoMask<DIVISIONS>::Classify(MASK nMask)
+{
+	// plain forms take precedence over inverted ones, as in CPitchClassSet
+	CLASSIFY	cls;
+	int	nStart = FindCanonicalRotation(nMask);
+	MASK	nCanon = Rotate(nMask, (DIVISIONS - nStart) % DIVISIONS);
+	MASK	nInverse = Invert(nMask);
+	int	nInvStart = FindCanonicalRotation(nInverse);
+	MASK	nInvCanon = Rotate(nInverse, (DIVISIONS - nInvStart) % DIVISIONS);
+	if (IsGreater(nInvCanon, nCanon)) {	// if inversion's canonical rotation wins
+		cls.nPrime = nInvCanon;
+		cls.nTranspose = (DIVISIONS - nInvStart) % DIVISIONS;
+		cls.bInverted = true;
+	} else {
+		cls.nPrime = nCanon;
+		cls.nTranspose = nStart;
+		cls.bInverted = false;
+	}
+	return cls;
+}
+
+// CEdoClassCache memoizes CEdoMask::Classify. Up to FULL_TABLE_BITS
+// divisions, every mask is classified on construction; above that, results
+// are stored on demand in a fixed-size open-addressing hash table whose
+// slots are claimed by compare-and-swap, so any number of threads can share
+// one cache without locking. If a probe sequence is full, the mask is
+// classified without caching. The cache is owned by the caller and isn't
+// copyable.
+
+template<int DIVISIONS>
+class CEdoClassCache {
+public:
+// Types
+	typedef typename CEdoMask<DIVISIONS>::MASK MASK;
+	typedef typename CEdoMask<DIVISIONS>::CLASSIFY CLASSIFY;
+	enum {
+		FULL_TABLE_BITS = 16,	// maximum divisions for which every mask is classified up front
+		DEFAULT_HASH_BITS = 20,	// default size of hash table, in bits
+		MAX_PROBES = 16,	// maximum number of slots to probe before giving up
+	};
+
+// Construction
+	CEdoClassCache(int nHashBits = DEFAULT_HASH_BITS);
+	~CEdoClassCache();
+
+// Attributes
+	bool	IsFullTable() const;
+	int		GetSlotCount() const;
+
+// Operations
+	CLASSIFY	Classify(MASK nMask);
+
+protected:
+// Constants
+	enum {
+		TRANSPOSE_SHIFT = 32,	// slot's transposition is in bits 32 to 39
+		INVERTED_BIT = 40,		// slot's inversion flag
+		VALID_BIT = 41,			// set if slot is occupied
+	};
+
+// Data members
+	std::atomic<uint64_t>	*m_pSlot;	// array of slots, each containing a packed classification
+	int		m_nSlots;		// number of slots
+	bool	m_bFullTable;	// true if slots are indexed by mask
+
+// Helpers
+	static	uint64_t	Pack(MASK nMask, const CLASSIFY& cls);
+	static	CLASSIFY	Unpack(uint64_t nSlot);
+	static	int		Hash(MASK nMask, int nSlots);
+
+private:
+	CEdoClassCache(const CEdoClassCache&);	// not copyable
+	CEdoClassCache& operator=(const CEdoClassCache&);
+};
+
+template<int DIVISIONS>
+inline CEdoClassCache<DIVISIONS>::CEdoClassCache(int nHashBits)
+{
+	m_bFullTable = DIVISIONS <= FULL_TABLE_BITS;
+	m_nSlots = 1 << (m_bFullTable ? DIVISIONS : nHashBits);
+	m_pSlot = new std::atomic<uint64_t>[m_nSlots];
+	if (m_bFullTable) {
+		for (int nMask = 0; nMask < m_nSlots; nMask++)
+			m_pSlot[nMask].store(Pack(nMask, CEdoMask<DIVISIONS>::Classify(nMask)), std::memory_order_relaxed);
+	} else {
+		for (int iSlot = 0; iSlot < m_nSlots; iSlot++)
+			m_pSlot[iSlot].store(0, std::memory_order_relaxed);
+	}
+}
+
+template<int DIVISIONS>
+inline CEdoClassCache<DIVISIONS>::~CEdoClassCache()
+{
+	delete [] m_pSlot;
+}
+
+template<int DIVISIONS>
+inline bool CEdoClassCache<DIVISIONS>::IsFullTable() const
+{
+	return m_bFullTable;
+}
+
+template<int DIVISIONS>
+inline int CEdoClassCache<DIVISIONS>::GetSlotCount() const
+{
+	return m_nSlots;
+}
+
+template<int DIVISIONS>
+inline uint64_t CEdoClassCache<DIVISIONS>::Pack(MASK nMask, const CLASSIFY& cls)
+{
+	// the prime form isn't stored, because it can be recovered from the
+	// mask by undoing the transposition and inversion
+	return nMask
+		| (static_cast<uint64_t>(cls.nTranspose) << TRANSPOSE_SHIFT)
+		| (static_cast<uint64_t>(cls.bInverted) << INVERTED_BIT)
+		| (static_cast<uint64_t>(1) << VALID_BIT);
+}
+
+template<int DIVISIONS>
+inline typename CEdoClassCache<DIVISIONS>::CLASSIFY CEdoClassCache<DIVISIONS>::Unpack(uint64_t nSlot)
+{
+	CLASSIFY	cls;
+	MASK	nMask = static_cast<MASK>(nSlot);
+	cls.nTranspose = static_cast<int>((nSlot >> TRANSPOSE_SHIFT) & 0xff);
+	cls.bInverted = ((nSlot >> INVERTED_BIT) & 1) != 0;
+	cls.nPrime = CEdoMask<DIVISIONS>::Rotate(nMask, (DIVISIONS - cls.nTranspose) % DIVISIONS);
+	if (cls.bInverted)
+		cls.nPrime = CEdoMask<DIVISIONS>::Invert(cls.nPrime);
+	return cls;
+}
+
+template<int DIVISIONS>
+inline int CEdoClassCache<DIVISIONS>::Hash(MASK nMask, int nSlots)
+{
+	return static_cast<int>((static_cast<uint64_t>(nMask) * 0x9e3779b97f4a7c15ULL) >> 32) & (nSlots - 1);
+}
+
+template<int DIVISIONS>
+inline typename CEdoClassCache<DIVISIONS>::CLASSIFY CEdoClassCache<DIVISIONS>::Classify(MASK nMask)
+{
+	if (m_bFullTable)
+		return Unpack(m_pSlot[nMask].load(std::memory_order_relaxed));
+	int	iSlot = Hash(nMask, m_nSlots);
+	uint64_t	nPacked = 0;
+	for (int iProbe = 0; iProbe < MAX_PROBES; iProbe++) {
+		uint64_t	nSlot = m_pSlot[iSlot].load(std::memory_order_acquire);
+		if (!nSlot) {	// if empty slot
+			if (!nPacked)	// if not classified yet
+				nPacked = Pack(nMask, CEdoMask<DIVISIONS>::Classify(nMask));
+			if (m_pSlot[iSlot].compare_exchange_strong(nSlot, nPacked, std::memory_order_acq_rel))
+				return Unpack(nPacked);	// claimed slot
+			// another thread claimed slot first; nSlot now holds its value
+		}
+		if (static_cast<MASK>(nSlot) == nMask)	// if slot contains our mask
+			return Unpack(nSlot);
+		iSlot = (iSlot + 1) & (m_nSlots - 1);
+	}
+	return CEdoMask<DIVISIONS>::Classify(nMask);	// too crowded to cache
+}
@@ -0,0 +1,83 @@
+// Copyleft 2026 Chris Korda
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation; either version 2 of the License, or any later version.
+/*
+		chris korda
+ 
+		revision history:
+		rev		date	comments
+		00		17oct26	initial version
+
+*/
+
+// this table is generated by MakeForteHash in SetConsonance.cpp; don't edit it
+
+#define FORTE_HASH_MULT 0xe01e11666d4261d7ULL
+
+const BYTE CPitchClassSet::m_arrForteHash[FORTE_HASH_SIZE] = {
+	255, 18, 255, 255, 255, 255, 255, 255, 219, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 83,
+	255, 255, 255, 77, 255, 255, 255, 255, 132, 255, 21, 55, 127, 255, 51, 255,
+	185, 255, 255, 255, 255, 70, 255, 255, 255, 255, 7, 255, 255, 255, 255, 255,
+	112, 255, 255, 255, 255, 255, 255, 135, 255, 255, 255, 255, 255, 255, 255, 163,
+	255, 255, 85, 157, 255, 255, 81, 255, 255, 255, 255, 255, 255, 73, 255, 255,
+	255, 60, 255, 255, 255, 255, 255, 118, 255, 139, 105, 255, 255, 255, 186, 255,
+	178, 255, 255, 67, 255, 255, 173, 255, 255, 255, 255, 115, 255, 137, 103, 255,
+	255, 255, 184, 255, 177, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	78, 255, 92, 255, 68, 255, 255, 28, 255, 133, 255, 20, 255, 122, 255, 255,
+	255, 187, 212, 210, 255, 255, 80, 255, 255, 255, 255, 255, 255, 25, 255, 255,
+	131, 109, 57, 255, 255, 255, 255, 209, 255, 255, 255, 255, 255, 207, 255, 255,
+	255, 255, 170, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 206, 255, 255, 255, 255, 169, 255, 255, 202, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 74, 255, 255, 255, 255, 255, 255, 255, 255, 255, 125, 255,
+	49, 255, 255, 255, 255, 255, 255, 255, 17, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 119, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	161, 255, 255, 255, 162, 255, 104, 79, 255, 255, 40, 255, 255, 255, 29, 255,
+	134, 255, 56, 255, 255, 255, 255, 255, 152, 255, 255, 255, 255, 255, 255, 6,
+	26, 255, 255, 168, 123, 255, 255, 255, 255, 255, 255, 255, 99, 255, 255, 255,
+	101, 255, 255, 255, 255, 255, 255, 167, 218, 255, 217, 255, 255, 255, 255, 255,
+	96, 255, 255, 255, 97, 62, 255, 255, 255, 155, 255, 255, 255, 255, 120, 255,
+	255, 255, 255, 255, 216, 255, 255, 255, 88, 16, 255, 255, 255, 255, 117, 255,
+	255, 255, 116, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 15,
+	255, 255, 255, 255, 255, 108, 102, 36, 63, 255, 255, 30, 255, 128, 255, 22,
+	255, 124, 255, 142, 255, 255, 255, 164, 182, 255, 72, 255, 255, 42, 255, 255,
+	255, 33, 255, 129, 255, 111, 59, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 48, 255, 255, 27, 255, 5, 255, 255, 255, 255, 255, 255, 255, 136, 255,
+	255, 255, 176, 106, 175, 255, 174, 255, 255, 255, 166, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 147, 255, 98, 69, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 126, 255, 50, 255, 255, 255, 255, 145, 255, 255, 255, 255, 255, 255,
+	14, 255, 255, 255, 159, 255, 121, 208, 255, 255, 255, 255, 255, 255, 255, 255,
+	222, 91, 255, 255, 255, 0, 255, 255, 165, 255, 45, 255, 255, 255, 41, 255,
+	255, 205, 31, 204, 130, 89, 53, 255, 255, 255, 255, 255, 153, 255, 255, 255,
+	44, 255, 255, 255, 35, 255, 255, 160, 255, 87, 255, 255, 203, 255, 255, 255,
+	255, 255, 255, 255, 107, 255, 255, 255, 255, 255, 255, 158, 255, 86, 4, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 100, 54, 255, 255, 255, 255, 255, 255,
+	255, 255, 113, 255, 150, 255, 255, 197, 255, 190, 255, 255, 90, 255, 255, 255,
+	255, 13, 255, 255, 143, 255, 110, 255, 148, 255, 255, 196, 255, 192, 255, 255,
+	255, 221, 255, 255, 255, 255, 255, 11, 255, 255, 93, 255, 255, 255, 255, 32,
+	255, 255, 255, 23, 255, 255, 255, 151, 255, 255, 199, 255, 255, 47, 255, 255,
+	255, 46, 255, 255, 255, 37, 255, 255, 255, 95, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 66, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 3, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 12, 255, 255, 255, 255, 154, 255, 255, 200, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 10, 255, 255, 146, 255, 255, 255, 255,
+	191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 215,
+	255, 255, 43, 255, 255, 255, 34, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 141, 255, 255, 39, 255, 181, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 144, 255, 76, 255, 195, 188, 65,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 138, 255, 255,
+	255, 255, 180, 255, 255, 255, 255, 255, 156, 255, 255, 201, 2, 194, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 9, 255, 255, 149, 255, 84, 198,
+	255, 193, 255, 255, 255, 255, 255, 255, 255, 58, 255, 255, 255, 52, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 24, 255, 255, 255, 255, 255, 255, 255, 255,
+	255, 255, 172, 255, 255, 255, 255, 255, 255, 38, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 255, 214, 255, 255, 255, 255, 255, 255, 255, 75, 255, 255, 255,
+	61, 255, 255, 255, 255, 255, 255, 19, 140, 183, 255, 255, 255, 189, 255, 179,
+	255, 255, 71, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 94, 255, 255,
+	255, 255, 255, 255, 255, 255, 255, 255, 255, 8, 255, 255, 255, 255, 255, 255,
+	255, 255, 255, 1, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	213, 255, 211, 255, 255, 82, 255, 255, 255, 255, 255, 255, 255, 255, 114, 255,
+	64, 255, 255, 171, 220, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+};
@@ -8,6 +8,7 @@
 		revision history:
 		rev		date	comments
         00      17jan23	initial version
+		01		17oct26	add packed interval set
 
 */
 
@@ -139,3 +140,83 @@ int CIntervalSet::GetRangeSum() const
 	}
 	return nSum;
 }
+
+CPackedIntervalSet::CPackedIntervalSet(const CIntervalSet& set)
+{
+	m_set.dw = 0;
+	int	nPlaces = set.GetSize();
+	for (int iPlace = 0; iPlace < nPlaces; iPlace++)
+		SetAt(iPlace, set[iPlace]);
+}
+
+std::string CPackedIntervalSet::FormatSet(int nPlaces) const
+{
+	// same format as CIntervalSet::FormatSet
+	ASSERT(nPlaces >= 0 && nPlaces <= MAX_PLACES);
+	std::string	sResult;
+	sResult = '(';
+	static const char	szHexDigit[] = "0123456789ABCDEF";
+	for (int iPlace = 0; iPlace < nPlaces; iPlace++) {
+		if (iPlace)
+			sResult += ',';
+		int	nDigit = m_set.b[iPlace];
+		if (nDigit >= 16)
+			sResult += szHexDigit[nDigit >> 4];
+		sResult += szHexDigit[nDigit & 0xf];
+	}
+	sResult += ')';
+	return sResult;
+}
+
+int CIntervalSetRange::GetPermutationCount() const
+{
+	int	nPerms = 1;
+	for (int iPlace = 0; iPlace < m_nPlaces; iPlace++)
+		nPerms *= m_range.b[iPlace];
+	return nPerms;
+}
+
+int CIntervalSetRange::Pack(const CPackedIntervalSet& set) const
+{
+	// same packing as CIntervalSet::Pack
+	int	nPackedVal = 0;
+	int	nPlaces = m_nPlaces;
+#if PACK_BIG_ENDIAN
+	for (int iPlace = 0; iPlace < nPlaces; iPlace++) {
+#else
+	for (int iPlace = nPlaces - 1; iPlace >= 0; iPlace--) {
+#endif
+		nPackedVal *= m_range.b[iPlace];
+		nPackedVal += set.GetAt(iPlace);
+	}
+	return nPackedVal;
+}
+
+void CIntervalSetRange::Unpack(int nPackedVal, CPackedIntervalSet& set) const
+{
+	// same unpacking as CIntervalSet::Unpack
+	int	nPlaces = m_nPlaces;
+	set.Clear();
+#if PACK_BIG_ENDIAN
+	for (int iPlace = nPlaces - 1; iPlace >= 0; iPlace--) {
+#else
+	for (int iPlace = 0; iPlace < nPlaces; iPlace++) {
+#endif
+		int	nRange = m_range.b[iPlace];
+		set.SetAt(iPlace, nPackedVal % nRange);
+		nPackedVal /= nRange;
+	}
+}
+
+void CIntervalSetRange::Expand(const CPackedIntervalSet& set, CIntervalSet& setOut) const
+{
+	// setOut receives an unpacked copy of set, with our ranges
+	setOut.Alloc(m_range);
+	for (int iPlace = 0; iPlace < m_nPlaces; iPlace++)
+		setOut[iPlace] = set.GetAt(iPlace);
+}
+
+std::string CIntervalSetRange::FormatSet(const CPackedIntervalSet& set) const
+{
+	return set.FormatSet(m_nPlaces);
+}
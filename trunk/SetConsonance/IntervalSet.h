@@ -8,6 +8,7 @@
 		revision history:
 		rev		date	comments
         00      17jan23	initial version
+		01		17oct26	add packed interval set
 
 */
 
@@ -51,4 +52,158 @@ inline int CIntervalSet::GetRange(int iPlace) const
 	return m_arrRange[iPlace];
 }
 
+// A packed interval set stores one digit per byte in a SET union, so it's
+// eight bytes and copies as a single integer. Unused places are zero. The
+// ranges aren't stored in the set; they're shared by all sets having the
+// same shape, via a separate range descriptor.
+
+class CPackedIntervalSet {
+public:
+// Construction
+	CPackedIntervalSet();
+	explicit CPackedIntervalSet(const CIntervalSet& set);
+	explicit CPackedIntervalSet(const CIntervalSet::SET& set);
+
+// Attributes
+	int		GetAt(int iPlace) const;
+	void	SetAt(int iPlace, int nDigit);
+	int		GetSum() const;
+	const CIntervalSet::SET&	GetSet() const;
+	bool	operator==(const CPackedIntervalSet& set) const;
+	bool	operator!=(const CPackedIntervalSet& set) const;
+
+// Operations
+	void	Clear();
+	std::string	FormatSet(int nPlaces) const;
+
+protected:
+// Data members
+	CIntervalSet::SET	m_set;	// digit of each place
+};
+
+class CIntervalSetRange {
+public:
+// Construction
+	CIntervalSetRange();
+	explicit CIntervalSetRange(const CIntervalSet::SET& arrRange);
+	explicit CIntervalSetRange(const CIntervalSet& set);
+	void	Alloc(const CIntervalSet::SET& arrRange);
+
+// Attributes
+	int		GetPlaceCount() const;
+	int		GetRange(int iPlace) const;
+	const CIntervalSet::SET&	GetRange() const;
+	int		GetPermutationCount() const;
+	int		GetRangeSum() const;
+
+// Operations
+	int		Pack(const CPackedIntervalSet& set) const;
+	void	Unpack(int nPackedVal, CPackedIntervalSet& set) const;
+	void	Expand(const CPackedIntervalSet& set, CIntervalSet& setOut) const;
+	std::string	FormatSet(const CPackedIntervalSet& set) const;
+
+protected:
+// Data members
+	int		m_nPlaces;		// number of places
+	CIntervalSet::SET	m_range;	// range of each place
+};
+
+inline CPackedIntervalSet::CPackedIntervalSet()
+{
+	m_set.dw = 0;
+}
+
+inline CPackedIntervalSet::CPackedIntervalSet(const CIntervalSet::SET& set)
+{
+	m_set = set;
+}
+
+inline int CPackedIntervalSet::GetAt(int iPlace) const
+{
+	ASSERT(iPlace >= 0 && iPlace < MAX_PLACES);
+	return m_set.b[iPlace];
+}
+
+inline void CPackedIntervalSet::SetAt(int iPlace, int nDigit)
+{
+	ASSERT(iPlace >= 0 && iPlace < MAX_PLACES);
+	ASSERT(nDigit >= 0 && nDigit <= 0xff);
+	m_set.b[iPlace] = static_cast<uint8_t>(nDigit);
+}
+
+inline int CPackedIntervalSet::GetSum() const
+{
+	// sum all eight bytes at once; unused places are zero, and the sum of
+	// digits is less than 256, so the top byte of the product is the sum
+	return static_cast<int>((m_set.dw * 0x0101010101010101ULL) >> 56);
+}
+
+inline const CIntervalSet::SET& CPackedIntervalSet::GetSet() const
+{
+	return m_set;
+}
+
+inline bool CPackedIntervalSet::operator==(const CPackedIntervalSet& set) const
+{
+	return m_set.dw == set.m_set.dw;
+}
+
+inline bool CPackedIntervalSet::operator!=(const CPackedIntervalSet& set) const
+{
+	return m_set.dw != set.m_set.dw;
+}
+
+inline void CPackedIntervalSet::Clear()
+{
+	m_set.dw = 0;
+}
+
+inline CIntervalSetRange::CIntervalSetRange()
+{
+	m_nPlaces = 0;
+	m_range.dw = 0;
+}
+
+inline CIntervalSetRange::CIntervalSetRange(const CIntervalSet::SET& arrRange)
+{
+	Alloc(arrRange);
+}
+
+inline CIntervalSetRange::CIntervalSetRange(const CIntervalSet& set)
+{
+	CIntervalSet::SET	arrRange;
+	set.GetRange(arrRange);
+	Alloc(arrRange);
+}
+
+inline void CIntervalSetRange::Alloc(const CIntervalSet::SET& arrRange)
+{
+	m_nPlaces = CIntervalSet::CountPlaces(arrRange);
+	m_range = arrRange;
+}
+
+inline int CIntervalSetRange::GetPlaceCount() const
+{
+	return m_nPlaces;
+}
+
+inline int CIntervalSetRange::GetRange(int iPlace) const
+{
+	ASSERT(iPlace >= 0 && iPlace < m_nPlaces);
+	return m_range.b[iPlace];
+}
+
+inline const CIntervalSet::SET& CIntervalSetRange::GetRange() const
+{
+	return m_range;
+}
+
+inline int CIntervalSetRange::GetRangeSum() const
+{
+	int	nSum = 0;
+	for (int iPlace = 0; iPlace < m_nPlaces; iPlace++)
+		nSum += m_range.b[iPlace];
+	return nSum;
+}
+
 #endif
@@ -0,0 +1,643 @@
+// Copyleft 2026 Chris Korda
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation; either version 2 of the License, or any later version.
+/*
+		chris korda
+ 
+		revision history:
+		rev		date	comments
+		00		17oct26	initial version
+
+*/
+
+// this table is generated by MakeMaskClassTable in SetConsonance.cpp; don't edit it
+
+const CPitchClassSet::MASK_CLASS_TABLE CPitchClassSet::m_tblMaskClass = {
+	{
+		{255, 0, 0, 0}, {0, 0, 0, 1}, {0, 1, 0, 1}, {1, 0, 0, 2}, {0, 2, 0, 1}, {2, 0, 0, 2}, {1, 1, 0, 2}, {7, 0, 0, 3},
+		{0, 3, 0, 1}, {3, 0, 0, 2}, {2, 1, 0, 2}, {8, 0, 0, 3}, {1, 2, 0, 2}, {8, 3, 1, 3}, {7, 1, 0, 3}, {19, 0, 0, 4},
+		{0, 4, 0, 1}, {4, 0, 0, 2}, {3, 1, 0, 2}, {9, 0, 0, 3}, {2, 2, 0, 2}, {12, 0, 0, 3}, {8, 1, 0, 3}, {20, 0, 0, 4},
+		{1, 3, 0, 2}, {9, 4, 1, 3}, {8, 4, 1, 3}, {21, 0, 0, 4}, {7, 2, 0, 3}, {20, 4, 1, 4}, {19, 1, 0, 4}, {48, 0, 0, 5},
+		{0, 5, 0, 1}, {5, 0, 0, 2}, {4, 1, 0, 2}, {10, 0, 0, 3}, {3, 2, 0, 2}, {13, 0, 0, 3}, {9, 1, 0, 3}, {22, 0, 0, 4},
+		{2, 3, 0, 2}, {13, 5, 1, 3}, {12, 1, 0, 3}, {29, 0, 0, 4}, {8, 2, 0, 3}, {28, 0, 0, 4}, {20, 1, 0, 4}, {49, 0, 0, 5},
+		{1, 4, 0, 2}, {10, 5, 1, 3}, {9, 5, 1, 3}, {25, 0, 0, 4}, {8, 5, 1, 3}, {29, 5, 1, 4}, {21, 1, 0, 4}, {50, 0, 0, 5},
+		{7, 3, 0, 3}, {22, 5, 1, 4}, {20, 5, 1, 4}, {50, 5, 1, 5}, {19, 2, 0, 4}, {49, 5, 1, 5}, {48, 1, 0, 5}, {86, 0, 0, 6},
+		{0, 6, 0, 1}, {6, 0, 0, 2}, {5, 1, 0, 2}, {11, 0, 0, 3}, {4, 2, 0, 2}, {14, 0, 0, 3}, {10, 1, 0, 3}, {23, 0, 0, 4},
+		{3, 3, 0, 2}, {16, 0, 0, 3}, {13, 1, 0, 3}, {31, 0, 0, 4}, {9, 2, 0, 3}, {30, 0, 0, 4}, {22, 1, 0, 4}, {51, 0, 0, 5},
+		{2, 4, 0, 2}, {14, 6, 1, 3}, {13, 6, 1, 3}, {33, 0, 0, 4}, {12, 2, 0, 3}, {40, 0, 0, 4}, {29, 1, 0, 4}, {56, 0, 0, 5},
+		{8, 3, 0, 3}, {30, 6, 1, 4}, {28, 1, 0, 4}, {57, 0, 0, 5}, {20, 2, 0, 4}, {55, 0, 0, 5}, {49, 1, 0, 5}, {87, 0, 0, 6},
+		{1, 5, 0, 2}, {11, 6, 1, 3}, {10, 6, 1, 3}, {26, 0, 0, 4}, {9, 6, 1, 3}, {33, 6, 1, 4}, {25, 1, 0, 4}, {53, 0, 0, 5},
+		{8, 6, 1, 3}, {31, 6, 1, 4}, {29, 6, 1, 4}, {59, 0, 0, 5}, {21, 2, 0, 4}, {57, 6, 1, 5}, {50, 1, 0, 5}, {88, 0, 0, 6},
+		{7, 4, 0, 3}, {23, 6, 1, 4}, {22, 6, 1, 4}, {53, 6, 1, 5}, {20, 6, 1, 4}, {56, 6, 1, 5}, {50, 6, 1, 5}, {90, 0, 0, 6},
+		{19, 3, 0, 4}, {51, 6, 1, 5}, {49, 6, 1, 5}, {88, 6, 1, 6}, {48, 2, 0, 5}, {87, 6, 1, 6}, {86, 1, 0, 6}, {136, 0, 0, 7},
+		{0, 7, 0, 1}, {5, 7, 0, 2}, {6, 1, 0, 2}, {11, 1, 1, 3}, {5, 2, 0, 2}, {15, 0, 0, 3}, {11, 1, 0, 3}, {24, 0, 0, 4},
+		{4, 3, 0, 2}, {17, 0, 0, 3}, {14, 1, 0, 3}, {34, 0, 0, 4}, {10, 2, 0, 3}, {32, 0, 0, 4}, {23, 1, 0, 4}, {52, 0, 0, 5},
+		{3, 4, 0, 2}, {17, 7, 1, 3}, {16, 1, 0, 3}, {37, 0, 0, 4}, {13, 2, 0, 3}, {41, 0, 0, 4}, {31, 1, 0, 4}, {60, 0, 0, 5},
+		{9, 3, 0, 3}, {36, 0, 0, 4}, {30, 1, 0, 4}, {64, 0, 0, 5}, {22, 2, 0, 4}, {58, 0, 0, 5}, {51, 1, 0, 5}, {89, 0, 0, 6},
+		{2, 5, 0, 2}, {15, 5, 0, 3}, {14, 7, 1, 3}, {35, 0, 0, 4}, {13, 7, 1, 3}, {42, 0, 0, 4}, {33, 1, 0, 4}, {62, 0, 0, 5},
+		{12, 3, 0, 3}, {41, 7, 1, 4}, {40, 1, 0, 4}, {74, 0, 0, 5}, {29, 2, 0, 4}, {73, 0, 0, 5}, {56, 1, 0, 5}, {97, 0, 0, 6},
+		{8, 4, 0, 3}, {32, 7, 1, 4}, {30, 7, 1, 4}, {67, 0, 0, 5}, {28, 2, 0, 4}, {73, 7, 1, 5}, {57, 1, 0, 5}, {100, 0, 0, 6},
+		{20, 3, 0, 4}, {58, 7, 1, 5}, {55, 1, 0, 5}, {98, 0, 0, 6}, {49, 2, 0, 5}, {96, 0, 0, 6}, {87, 1, 0, 6}, {137, 0, 0, 7},
+		{1, 6, 0, 2}, {11, 6, 0, 3}, {11, 7, 1, 3}, {27, 0, 0, 4}, {10, 7, 1, 3}, {35, 7, 1, 4}, {26, 1, 0, 4}, {54, 0, 0, 5},
+		{9, 7, 1, 3}, {37, 7, 1, 4}, {33, 7, 1, 4}, {69, 0, 0, 5}, {25, 2, 0, 4}, {67, 7, 1, 5}, {53, 1, 0, 5}, {92, 0, 0, 6},
+		{8, 7, 1, 3}, {34, 7, 1, 4}, {31, 7, 1, 4}, {69, 7, 1, 5}, {29, 7, 1, 4}, {74, 7, 1, 5}, {59, 1, 0, 5}, {102, 0, 0, 6},
+		{21, 3, 0, 4}, {64, 7, 1, 5}, {57, 7, 1, 5}, {104, 0, 0, 6}, {50, 2, 0, 5}, {98, 7, 1, 6}, {88, 1, 0, 6}, {139, 0, 0, 7},
+		{7, 5, 0, 3}, {24, 5, 0, 4}, {23, 7, 1, 4}, {54, 7, 1, 5}, {22, 7, 1, 4}, {62, 7, 1, 5}, {53, 7, 1, 5}, {93, 0, 0, 6},
+		{20, 7, 1, 4}, {60, 7, 1, 5}, {56, 7, 1, 5}, {102, 7, 1, 6}, {50, 7, 1, 5}, {100, 7, 1, 6}, {90, 1, 0, 6}, {140, 0, 0, 7},
+		{19, 4, 0, 4}, {52, 7, 1, 5}, {51, 7, 1, 5}, {92, 7, 1, 6}, {49, 7, 1, 5}, {97, 7, 1, 6}, {88, 7, 1, 6}, {140, 7, 1, 7},
+		{48, 3, 0, 5}, {89, 7, 1, 6}, {87, 7, 1, 6}, {139, 7, 1, 7}, {86, 2, 0, 6}, {137, 7, 1, 7}, {136, 1, 0, 7}, {174, 0, 0, 8},
+		{0, 8, 0, 1}, {4, 8, 0, 2}, {5, 8, 0, 2}, {10, 1, 1, 3}, {6, 2, 0, 2}, {14, 2, 1, 3}, {11, 2, 1, 3}, {23, 2, 1, 4},
+		{5, 3, 0, 2}, {17, 3, 1, 3}, {15, 1, 0, 3}, {32, 3, 1, 4}, {11, 2, 0, 3}, {34, 3, 1, 4}, {24, 1, 0, 4}, {52, 3, 1, 5},
+		{4, 4, 0, 2}, {18, 0, 0, 3}, {17, 1, 0, 3}, {38, 0, 0, 4}, {14, 2, 0, 3}, {43, 0, 0, 4}, {34, 1, 0, 4}, {61, 0, 0, 5},
+		{10, 3, 0, 3}, {38, 4, 1, 4}, {32, 1, 0, 4}, {65, 0, 0, 5}, {23, 2, 0, 4}, {61, 4, 1, 5}, {52, 1, 0, 5}, {91, 0, 0, 6},
+		{3, 5, 0, 2}, {17, 5, 0, 3}, {17, 8, 1, 3}, {39, 0, 0, 4}, {16, 2, 0, 3}, {46, 0, 0, 4}, {37, 1, 0, 4}, {68, 0, 0, 5},
+		{13, 3, 0, 3}, {45, 0, 0, 4}, {41, 1, 0, 4}, {77, 0, 0, 5}, {31, 2, 0, 4}, {75, 0, 0, 5}, {60, 1, 0, 5}, {101, 0, 0, 6},
+		{9, 4, 0, 3}, {38, 4, 0, 4}, {36, 1, 0, 4}, {71, 0, 0, 5}, {30, 2, 0, 4}, {76, 0, 0, 5}, {64, 1, 0, 5}, {107, 0, 0, 6},
+		{22, 3, 0, 4}, {66, 0, 0, 5}, {58, 1, 0, 5}, {106, 0, 0, 6}, {51, 2, 0, 5}, {99, 0, 0, 6}, {89, 1, 0, 6}, {138, 0, 0, 7},
+		{2, 6, 0, 2}, {14, 6, 0, 3}, {15, 6, 0, 3}, {35, 1, 1, 4}, {14, 8, 1, 3}, {44, 0, 0, 4}, {35, 1, 0, 4}, {63, 0, 0, 5},
+		{13, 8, 1, 3}, {46, 8, 1, 4}, {42, 1, 0, 4}, {79, 0, 0, 5}, {33, 2, 0, 4}, {78, 0, 0, 5}, {62, 1, 0, 5}, {103, 0, 0, 6},
+		{12, 4, 0, 3}, {43, 4, 0, 4}, {41, 8, 1, 4}, {80, 0, 0, 5}, {40, 2, 0, 4}, {83, 0, 0, 5}, {74, 1, 0, 5}, {116, 0, 0, 6},
+		{29, 3, 0, 4}, {76, 8, 1, 5}, {73, 1, 0, 5}, {119, 0, 0, 6}, {56, 2, 0, 5}, {115, 0, 0, 6}, {97, 1, 0, 6}, {144, 0, 0, 7},
+		{8, 5, 0, 3}, {34, 5, 0, 4}, {32, 8, 1, 4}, {70, 0, 0, 5}, {30, 8, 1, 4}, {78, 8, 1, 5}, {67, 1, 0, 5}, {110, 0, 0, 6},
+		{28, 3, 0, 4}, {75, 8, 1, 5}, {73, 8, 1, 5}, {121, 0, 0, 6}, {57, 2, 0, 5}, {117, 0, 0, 6}, {100, 1, 0, 6}, {148, 0, 0, 7},
+		{20, 4, 0, 4}, {61, 4, 0, 5}, {58, 8, 1, 5}, {108, 0, 0, 6}, {55, 2, 0, 5}, {115, 8, 1, 6}, {98, 1, 0, 6}, {149, 0, 0, 7},
+		{49, 3, 0, 5}, {99, 8, 1, 6}, {96, 1, 0, 6}, {146, 0, 0, 7}, {87, 2, 0, 6}, {143, 0, 0, 7}, {137, 1, 0, 7}, {175, 0, 0, 8},
+		{1, 7, 0, 2}, {10, 7, 0, 3}, {11, 7, 0, 3}, {26, 7, 0, 4}, {11, 8, 1, 3}, {35, 7, 0, 4}, {27, 1, 0, 4}, {54, 2, 1, 5},
+		{10, 8, 1, 3}, {39, 7, 0, 4}, {35, 8, 1, 4}, {70, 7, 0, 5}, {26, 2, 0, 4}, {70, 8, 1, 5}, {54, 1, 0, 5}, {94, 0, 0, 6},
+		{9, 8, 1, 3}, {38, 8, 1, 4}, {37, 8, 1, 4}, {72, 0, 0, 5}, {33, 8, 1, 4}, {80, 8, 1, 5}, {69, 1, 0, 5}, {109, 0, 0, 6},
+		{25, 3, 0, 4}, {71, 8, 1, 5}, {67, 8, 1, 5}, {112, 0, 0, 6}, {53, 2, 0, 5}, {108, 8, 1, 6}, {92, 1, 0, 6}, {141, 0, 0, 7},
+		{8, 8, 1, 3}, {32, 5, 0, 4}, {34, 8, 1, 4}, {70, 1, 1, 5}, {31, 8, 1, 4}, {79, 8, 1, 5}, {69, 8, 1, 5}, {111, 0, 0, 6},
+		{29, 8, 1, 4}, {77, 8, 1, 5}, {74, 8, 1, 5}, {123, 0, 0, 6}, {59, 2, 0, 5}, {121, 8, 1, 6}, {102, 1, 0, 6}, {150, 0, 0, 7},
+		{21, 4, 0, 4}, {65, 4, 0, 5}, {64, 8, 1, 5}, {112, 8, 1, 6}, {57, 8, 1, 5}, {119, 8, 1, 6}, {104, 1, 0, 6}, {156, 0, 0, 7},
+		{50, 3, 0, 5}, {106, 8, 1, 6}, {98, 8, 1, 6}, {154, 0, 0, 7}, {88, 2, 0, 6}, {146, 8, 1, 7}, {139, 1, 0, 7}, {177, 0, 0, 8},
+		{7, 6, 0, 3}, {23, 6, 0, 4}, {24, 6, 0, 4}, {54, 6, 0, 5}, {23, 8, 1, 4}, {63, 6, 0, 5}, {54, 8, 1, 5}, {95, 0, 0, 6},
+		{22, 8, 1, 4}, {68, 8, 1, 5}, {62, 8, 1, 5}, {111, 8, 1, 6}, {53, 8, 1, 5}, {110, 8, 1, 6}, {93, 1, 0, 6}, {142, 0, 0, 7},
+		{20, 8, 1, 4}, {61, 8, 1, 5}, {60, 8, 1, 5}, {109, 8, 1, 6}, {56, 8, 1, 5}, {116, 8, 1, 6}, {102, 8, 1, 6}, {151, 0, 0, 7},
+		{50, 8, 1, 5}, {107, 8, 1, 6}, {100, 8, 1, 6}, {156, 8, 1, 7}, {90, 2, 0, 6}, {149, 8, 1, 7}, {140, 1, 0, 7}, {178, 0, 0, 8},
+		{19, 5, 0, 4}, {52, 5, 0, 5}, {52, 8, 1, 5}, {94, 5, 0, 6}, {51, 8, 1, 5}, {103, 8, 1, 6}, {92, 8, 1, 6}, {142, 8, 1, 7},
+		{49, 8, 1, 5}, {101, 8, 1, 6}, {97, 8, 1, 6}, {150, 8, 1, 7}, {88, 8, 1, 6}, {148, 8, 1, 7}, {140, 8, 1, 7}, {179, 0, 0, 8},
+		{48, 4, 0, 5}, {91, 4, 0, 6}, {89, 8, 1, 6}, {141, 8, 1, 7}, {87, 8, 1, 6}, {144, 8, 1, 7}, {139, 8, 1, 7}, {178, 8, 1, 8},
+		{86, 3, 0, 6}, {138, 8, 1, 7}, {137, 8, 1, 7}, {177, 8, 1, 8}, {136, 2, 0, 7}, {175, 8, 1, 8}, {174, 1, 0, 8}, {203, 0, 0, 9},
+		{0, 9, 0, 1}, {3, 9, 0, 2}, {4, 9, 0, 2}, {9, 1, 1, 3}, {5, 9, 0, 2}, {13, 2, 1, 3}, {10, 2, 1, 3}, {22, 2, 1, 4},
+		{6, 3, 0, 2}, {16, 9, 0, 3}, {14, 3, 1, 3}, {30, 3, 1, 4}, {11, 3, 1, 3}, {31, 3, 1, 4}, {23, 3, 1, 4}, {51, 3, 1, 5},
+		{5, 4, 0, 2}, {17, 9, 0, 3}, {17, 4, 1, 3}, {36, 9, 0, 4}, {15, 2, 0, 3}, {41, 4, 1, 4}, {32, 4, 1, 4}, {58, 4, 1, 5},
+		{11, 3, 0, 3}, {37, 4, 1, 4}, {34, 4, 1, 4}, {64, 4, 1, 5}, {24, 2, 0, 4}, {60, 4, 1, 5}, {52, 4, 1, 5}, {89, 4, 1, 6},
+		{4, 5, 0, 2}, {17, 0, 1, 3}, {18, 1, 0, 3}, {38, 1, 1, 4}, {17, 2, 0, 3}, {45, 9, 0, 4}, {38, 1, 0, 4}, {66, 9, 0, 5},
+		{14, 3, 0, 3}, {46, 5, 1, 4}, {43, 1, 0, 4}, {76, 5, 1, 5}, {34, 2, 0, 4}, {75, 5, 1, 5}, {61, 1, 0, 5}, {99, 5, 1, 6},
+		{10, 4, 0, 3}, {39, 4, 0, 4}, {38, 5, 1, 4}, {71, 5, 1, 5}, {32, 2, 0, 4}, {77, 5, 1, 5}, {65, 1, 0, 5}, {106, 5, 1, 6},
+		{23, 3, 0, 4}, {68, 5, 1, 5}, {61, 5, 1, 5}, {107, 5, 1, 6}, {52, 2, 0, 5}, {101, 5, 1, 6}, {91, 1, 0, 6}, {138, 5, 1, 7},
+		{3, 6, 0, 2}, {16, 6, 0, 3}, {17, 6, 0, 3}, {37, 1, 1, 4}, {17, 9, 1, 3}, {46, 2, 1, 4}, {39, 1, 0, 4}, {68, 2, 1, 5},
+		{16, 3, 0, 3}, {47, 0, 0, 4}, {46, 1, 0, 4}, {81, 0, 0, 5}, {37, 2, 0, 4}, {81, 3, 1, 5}, {68, 1, 0, 5}, {105, 0, 0, 6},
+		{13, 4, 0, 3}, {46, 4, 0, 4}, {45, 1, 0, 4}, {82, 0, 0, 5}, {41, 2, 0, 4}, {84, 0, 0, 5}, {77, 1, 0, 5}, {120, 0, 0, 6},
+		{31, 3, 0, 4}, {81, 3, 0, 5}, {75, 1, 0, 5}, {125, 0, 0, 6}, {60, 2, 0, 5}, {118, 0, 0, 6}, {101, 1, 0, 6}, {145, 0, 0, 7},
+		{9, 5, 0, 3}, {37, 5, 0, 4}, {38, 5, 0, 4}, {72, 5, 0, 5}, {36, 2, 0, 4}, {82, 6, 1, 5}, {71, 1, 0, 5}, {113, 0, 0, 6},
+		{30, 3, 0, 4}, {81, 6, 1, 5}, {76, 1, 0, 5}, {126, 0, 0, 6}, {64, 2, 0, 5}, {125, 6, 1, 6}, {107, 1, 0, 6}, {152, 0, 0, 7},
+		{22, 4, 0, 4}, {68, 4, 0, 5}, {66, 1, 0, 5}, {113, 6, 1, 6}, {58, 2, 0, 5}, {120, 6, 1, 6}, {106, 1, 0, 6}, {153, 0, 0, 7},
+		{51, 3, 0, 5}, {105, 3, 0, 6}, {99, 1, 0, 6}, {152, 6, 1, 7}, {89, 2, 0, 6}, {145, 6, 1, 7}, {138, 1, 0, 7}, {176, 0, 0, 8},
+		{2, 7, 0, 2}, {13, 7, 0, 3}, {14, 7, 0, 3}, {33, 1, 1, 4}, {15, 7, 0, 3}, {42, 7, 0, 4}, {35, 2, 1, 4}, {62, 2, 1, 5},
+		{14, 9, 1, 3}, {46, 7, 0, 4}, {44, 1, 0, 4}, {78, 3, 1, 5}, {35, 2, 0, 4}, {79, 3, 1, 5}, {63, 1, 0, 5}, {103, 3, 1, 6},
+		{13, 9, 1, 3}, {45, 4, 0, 4}, {46, 9, 1, 4}, {82, 1, 1, 5}, {42, 2, 0, 4}, {85, 0, 0, 5}, {79, 1, 0, 5}, {122, 0, 0, 6},
+		{33, 3, 0, 4}, {82, 3, 0, 5}, {78, 1, 0, 5}, {127, 0, 0, 6}, {62, 2, 0, 5}, {122, 4, 1, 6}, {103, 1, 0, 6}, {147, 0, 0, 7},
+		{12, 5, 0, 3}, {41, 5, 0, 4}, {43, 5, 0, 4}, {80, 1, 1, 5}, {41, 9, 1, 4}, {85, 5, 0, 5}, {80, 1, 0, 5}, {124, 0, 0, 6},
+		{40, 3, 0, 4}, {84, 3, 0, 5}, {83, 1, 0, 5}, {134, 0, 0, 6}, {74, 2, 0, 5}, {133, 0, 0, 6}, {116, 1, 0, 6}, {162, 0, 0, 7},
+		{29, 4, 0, 4}, {77, 4, 0, 5}, {76, 9, 1, 5}, {131, 0, 0, 6}, {73, 2, 0, 5}, {132, 0, 0, 6}, {119, 1, 0, 6}, {165, 0, 0, 7},
+		{56, 3, 0, 5}, {120, 3, 0, 6}, {115, 1, 0, 6}, {164, 0, 0, 7}, {97, 2, 0, 6}, {161, 0, 0, 7}, {144, 1, 0, 7}, {184, 0, 0, 8},
+		{8, 6, 0, 3}, {31, 6, 0, 4}, {34, 6, 0, 4}, {69, 6, 0, 5}, {32, 9, 1, 4}, {79, 6, 0, 5}, {70, 1, 0, 5}, {111, 2, 1, 6},
+		{30, 9, 1, 4}, {81, 6, 0, 5}, {78, 9, 1, 5}, {130, 0, 0, 6}, {67, 2, 0, 5}, {128, 0, 0, 6}, {110, 1, 0, 6}, {157, 0, 0, 7},
+		{28, 4, 0, 4}, {75, 4, 0, 5}, {75, 9, 1, 5}, {129, 0, 0, 6}, {73, 9, 1, 5}, {133, 9, 1, 6}, {121, 1, 0, 6}, {167, 0, 0, 7},
+		{57, 3, 0, 5}, {125, 3, 0, 6}, {117, 1, 0, 6}, {169, 0, 0, 7}, {100, 2, 0, 6}, {163, 0, 0, 7}, {148, 1, 0, 7}, {186, 0, 0, 8},
+		{20, 5, 0, 4}, {60, 5, 0, 5}, {61, 5, 0, 5}, {109, 5, 0, 6}, {58, 9, 1, 5}, {122, 5, 0, 6}, {108, 1, 0, 6}, {158, 0, 0, 7},
+		{55, 3, 0, 5}, {118, 3, 0, 6}, {115, 9, 1, 6}, {166, 0, 0, 7}, {98, 2, 0, 6}, {163, 9, 1, 7}, {149, 1, 0, 7}, {189, 0, 0, 8},
+		{49, 4, 0, 5}, {101, 4, 0, 6}, {99, 9, 1, 6}, {155, 0, 0, 7}, {96, 2, 0, 6}, {161, 9, 1, 7}, {146, 1, 0, 7}, {187, 0, 0, 8},
+		{87, 3, 0, 6}, {145, 3, 0, 7}, {143, 1, 0, 7}, {185, 0, 0, 8}, {137, 2, 0, 7}, {183, 0, 0, 8}, {175, 1, 0, 8}, {204, 0, 0, 9},
+		{1, 8, 0, 2}, {9, 8, 0, 3}, {10, 8, 0, 3}, {25, 8, 0, 4}, {11, 8, 0, 3}, {33, 8, 0, 4}, {26, 8, 0, 4}, {53, 2, 1, 5},
+		{11, 9, 1, 3}, {37, 8, 0, 4}, {35, 8, 0, 4}, {67, 8, 0, 5}, {27, 2, 0, 4}, {69, 3, 1, 5}, {54, 3, 1, 5}, {92, 3, 1, 6},
+		{10, 9, 1, 3}, {38, 8, 0, 4}, {39, 8, 0, 4}, {71, 8, 0, 5}, {35, 9, 1, 4}, {80, 8, 0, 5}, {70, 8, 0, 5}, {108, 8, 0, 6},
+		{26, 3, 0, 4}, {72, 8, 0, 5}, {70, 9, 1, 5}, {112, 4, 1, 6}, {54, 2, 0, 5}, {109, 4, 1, 6}, {94, 1, 0, 6}, {141, 4, 1, 7},
+		{9, 9, 1, 3}, {36, 5, 0, 4}, {38, 9, 1, 4}, {71, 1, 1, 5}, {37, 9, 1, 4}, {82, 8, 0, 5}, {72, 1, 0, 5}, {113, 2, 1, 6},
+		{33, 9, 1, 4}, {82, 9, 1, 5}, {80, 9, 1, 5}, {131, 8, 0, 6}, {69, 2, 0, 5}, {129, 8, 0, 6}, {109, 1, 0, 6}, {155, 8, 0, 7},
+		{25, 4, 0, 4}, {71, 4, 0, 5}, {71, 9, 1, 5}, {114, 0, 0, 6}, {67, 9, 1, 5}, {131, 9, 1, 6}, {112, 1, 0, 6}, {159, 0, 0, 7},
+		{53, 3, 0, 5}, {113, 3, 0, 6}, {108, 9, 1, 6}, {159, 5, 1, 7}, {92, 2, 0, 6}, {155, 9, 1, 7}, {141, 1, 0, 7}, {180, 0, 0, 8},
+		{8, 9, 1, 3}, {30, 6, 0, 4}, {32, 6, 0, 4}, {67, 1, 1, 5}, {34, 9, 1, 4}, {78, 6, 0, 5}, {70, 2, 1, 5}, {110, 2, 1, 6},
+		{31, 9, 1, 4}, {81, 9, 1, 5}, {79, 9, 1, 5}, {128, 6, 0, 6}, {69, 9, 1, 5}, {130, 3, 1, 6}, {111, 1, 0, 6}, {157, 3, 1, 7},
+		{29, 9, 1, 4}, {76, 4, 0, 5}, {77, 9, 1, 5}, {131, 1, 1, 6}, {74, 9, 1, 5}, {134, 9, 1, 6}, {123, 1, 0, 6}, {168, 0, 0, 7},
+		{59, 3, 0, 5}, {126, 3, 0, 6}, {121, 9, 1, 6}, {170, 0, 0, 7}, {102, 2, 0, 6}, {166, 9, 1, 7}, {150, 1, 0, 7}, {188, 0, 0, 8},
+		{21, 5, 0, 4}, {64, 5, 0, 5}, {65, 5, 0, 5}, {112, 5, 0, 6}, {64, 9, 1, 5}, {127, 5, 0, 6}, {112, 9, 1, 6}, {160, 0, 0, 7},
+		{57, 9, 1, 5}, {125, 9, 1, 6}, {119, 9, 1, 6}, {170, 9, 1, 7}, {104, 2, 0, 6}, {169, 9, 1, 7}, {156, 1, 0, 7}, {192, 0, 0, 8},
+		{50, 4, 0, 5}, {107, 4, 0, 6}, {106, 9, 1, 6}, {159, 4, 0, 7}, {98, 9, 1, 6}, {164, 9, 1, 7}, {154, 1, 0, 7}, {193, 0, 0, 8},
+		{88, 3, 0, 6}, {152, 3, 0, 7}, {146, 9, 1, 7}, {191, 0, 0, 8}, {139, 2, 0, 7}, {185, 9, 1, 8}, {177, 1, 0, 8}, {205, 0, 0, 9},
+		{7, 7, 0, 3}, {22, 7, 0, 4}, {23, 7, 0, 4}, {53, 7, 0, 5}, {24, 7, 0, 4}, {62, 7, 0, 5}, {54, 7, 0, 5}, {93, 7, 0, 6},
+		{23, 9, 1, 4}, {68, 7, 0, 5}, {63, 7, 0, 5}, {110, 7, 0, 6}, {54, 9, 1, 5}, {111, 7, 0, 6}, {95, 1, 0, 6}, {142, 3, 1, 7},
+		{22, 9, 1, 4}, {66, 4, 0, 5}, {68, 9, 1, 5}, {113, 7, 0, 6}, {62, 9, 1, 5}, {124, 7, 0, 6}, {111, 9, 1, 6}, {158, 7, 0, 7},
+		{53, 9, 1, 5}, {113, 9, 1, 6}, {110, 9, 1, 6}, {160, 7, 0, 7}, {93, 2, 0, 6}, {158, 9, 1, 7}, {142, 1, 0, 7}, {181, 0, 0, 8},
+		{20, 9, 1, 4}, {58, 5, 0, 5}, {61, 9, 1, 5}, {108, 1, 1, 6}, {60, 9, 1, 5}, {122, 9, 1, 6}, {109, 9, 1, 6}, {158, 2, 1, 7},
+		{56, 9, 1, 5}, {120, 9, 1, 6}, {116, 9, 1, 6}, {168, 9, 1, 7}, {102, 9, 1, 6}, {167, 9, 1, 7}, {151, 1, 0, 7}, {190, 0, 0, 8},
+		{50, 9, 1, 5}, {106, 4, 0, 6}, {107, 9, 1, 6}, {159, 9, 1, 7}, {100, 9, 1, 6}, {165, 9, 1, 7}, {156, 9, 1, 7}, {194, 0, 0, 8},
+		{90, 3, 0, 6}, {153, 3, 0, 7}, {149, 9, 1, 7}, {193, 9, 1, 8}, {140, 2, 0, 7}, {187, 9, 1, 8}, {178, 1, 0, 8}, {206, 0, 0, 9},
+		{19, 6, 0, 4}, {51, 6, 0, 5}, {52, 6, 0, 5}, {92, 6, 0, 6}, {52, 9, 1, 5}, {103, 6, 0, 6}, {94, 6, 0, 6}, {142, 6, 0, 7},
+		{51, 9, 1, 5}, {105, 6, 0, 6}, {103, 9, 1, 6}, {157, 6, 0, 7}, {92, 9, 1, 6}, {157, 9, 1, 7}, {142, 9, 1, 7}, {182, 0, 0, 8},
+		{49, 9, 1, 5}, {99, 4, 0, 6}, {101, 9, 1, 6}, {155, 1, 1, 7}, {97, 9, 1, 6}, {162, 9, 1, 7}, {150, 9, 1, 7}, {190, 9, 1, 8},
+		{88, 9, 1, 6}, {152, 9, 1, 7}, {148, 9, 1, 7}, {192, 9, 1, 8}, {140, 9, 1, 7}, {189, 9, 1, 8}, {179, 1, 0, 8}, {207, 0, 0, 9},
+		{48, 5, 0, 5}, {89, 5, 0, 6}, {91, 5, 0, 6}, {141, 5, 0, 7}, {89, 9, 1, 6}, {147, 5, 0, 7}, {141, 9, 1, 7}, {181, 5, 0, 8},
+		{87, 9, 1, 6}, {145, 9, 1, 7}, {144, 9, 1, 7}, {188, 9, 1, 8}, {139, 9, 1, 7}, {186, 9, 1, 8}, {178, 9, 1, 8}, {207, 9, 1, 9},
+		{86, 4, 0, 6}, {138, 4, 0, 7}, {138, 9, 1, 7}, {180, 4, 0, 8}, {137, 9, 1, 7}, {184, 9, 1, 8}, {177, 9, 1, 8}, {206, 9, 1, 9},
+		{136, 3, 0, 7}, {176, 3, 0, 8}, {175, 9, 1, 8}, {205, 9, 1, 9}, {174, 2, 0, 8}, {204, 9, 1, 9}, {203, 1, 0, 9}, {215, 0, 0, 10},
+		{0, 10, 0, 1}, {2, 10, 0, 2}, {3, 10, 0, 2}, {8, 1, 1, 3}, {4, 10, 0, 2}, {12, 10, 0, 3}, {9, 2, 1, 3}, {20, 2, 1, 4},
+		{5, 10, 0, 2}, {13, 10, 0, 3}, {13, 3, 1, 3}, {28, 10, 0, 4}, {10, 3, 1, 3}, {29, 3, 1, 4}, {22, 3, 1, 4}, {49, 3, 1, 5},
+		{6, 4, 0, 2}, {14, 10, 0, 3}, {16, 10, 0, 3}, {30, 10, 0, 4}, {14, 4, 1, 3}, {40, 10, 0, 4}, {30, 4, 1, 4}, {55, 10, 0, 5},
+		{11, 4, 1, 3}, {33, 4, 1, 4}, {31, 4, 1, 4}, {57, 4, 1, 5}, {23, 4, 1, 4}, {56, 4, 1, 5}, {51, 4, 1, 5}, {87, 4, 1, 6},
+		{5, 5, 0, 2}, {15, 10, 0, 3}, {17, 10, 0, 3}, {32, 10, 0, 4}, {17, 5, 1, 3}, {41, 10, 0, 4}, {36, 10, 0, 4}, {58, 10, 0, 5},
+		{15, 3, 0, 3}, {42, 10, 0, 4}, {41, 5, 1, 4}, {73, 10, 0, 5}, {32, 5, 1, 4}, {73, 5, 1, 5}, {58, 5, 1, 5}, {96, 10, 0, 6},
+		{11, 4, 0, 3}, {35, 5, 1, 4}, {37, 5, 1, 4}, {67, 5, 1, 5}, {34, 5, 1, 4}, {74, 5, 1, 5}, {64, 5, 1, 5}, {98, 5, 1, 6},
+		{24, 3, 0, 4}, {62, 5, 1, 5}, {60, 5, 1, 5}, {100, 5, 1, 6}, {52, 5, 1, 5}, {97, 5, 1, 6}, {89, 5, 1, 6}, {137, 5, 1, 7},
+		{4, 6, 0, 2}, {14, 0, 1, 3}, {17, 1, 1, 3}, {34, 1, 1, 4}, {18, 2, 0, 3}, {43, 10, 0, 4}, {38, 2, 1, 4}, {61, 2, 1, 5},
+		{17, 3, 0, 3}, {46, 10, 0, 4}, {45, 10, 0, 4}, {75, 10, 0, 5}, {38, 2, 0, 4}, {76, 10, 0, 5}, {66, 10, 0, 5}, {99, 10, 0, 6},
+		{14, 4, 0, 3}, {44, 4, 0, 4}, {46, 6, 1, 4}, {78, 10, 0, 5}, {43, 2, 0, 4}, {83, 10, 0, 5}, {76, 6, 1, 5}, {115, 10, 0, 6},
+		{34, 3, 0, 4}, {78, 6, 1, 5}, {75, 6, 1, 5}, {117, 10, 0, 6}, {61, 2, 0, 5}, {115, 6, 1, 6}, {99, 6, 1, 6}, {143, 10, 0, 7},
+		{10, 5, 0, 3}, {35, 5, 0, 4}, {39, 5, 0, 4}, {70, 6, 1, 5}, {38, 6, 1, 4}, {80, 6, 1, 5}, {71, 6, 1, 5}, {108, 6, 1, 6},
+		{32, 3, 0, 4}, {79, 6, 1, 5}, {77, 6, 1, 5}, {121, 6, 1, 6}, {65, 2, 0, 5}, {119, 6, 1, 6}, {106, 6, 1, 6}, {146, 6, 1, 7},
+		{23, 4, 0, 4}, {63, 4, 0, 5}, {68, 6, 1, 5}, {110, 6, 1, 6}, {61, 6, 1, 5}, {116, 6, 1, 6}, {107, 6, 1, 6}, {149, 6, 1, 7},
+		{52, 3, 0, 5}, {103, 6, 1, 6}, {101, 6, 1, 6}, {148, 6, 1, 7}, {91, 2, 0, 6}, {144, 6, 1, 7}, {138, 6, 1, 7}, {175, 6, 1, 8},
+		{3, 7, 0, 2}, {13, 0, 1, 3}, {16, 7, 0, 3}, {31, 1, 1, 4}, {17, 7, 0, 3}, {41, 2, 1, 4}, {37, 2, 1, 4}, {60, 2, 1, 5},
+		{17, 10, 1, 3}, {45, 7, 0, 4}, {46, 3, 1, 4}, {75, 3, 1, 5}, {39, 2, 0, 4}, {77, 3, 1, 5}, {68, 3, 1, 5}, {101, 3, 1, 6},
+		{16, 4, 0, 3}, {46, 0, 1, 4}, {47, 1, 0, 4}, {81, 1, 1, 5}, {46, 2, 0, 4}, {84, 10, 0, 5}, {81, 1, 0, 5}, {118, 10, 0, 6},
+		{37, 3, 0, 4}, {82, 4, 1, 5}, {81, 4, 1, 5}, {125, 4, 1, 6}, {68, 2, 0, 5}, {120, 4, 1, 6}, {105, 1, 0, 6}, {145, 4, 1, 7},
+		{13, 5, 0, 3}, {42, 5, 0, 4}, {46, 5, 0, 4}, {79, 1, 1, 5}, {45, 2, 0, 4}, {85, 10, 0, 5}, {82, 1, 0, 5}, {122, 2, 1, 6},
+		{41, 3, 0, 4}, {85, 3, 0, 5}, {84, 1, 0, 5}, {133, 10, 0, 6}, {77, 2, 0, 5}, {132, 10, 0, 6}, {120, 1, 0, 6}, {161, 10, 0, 7},
+		{31, 4, 0, 4}, {79, 4, 0, 5}, {81, 4, 0, 5}, {128, 10, 0, 6}, {75, 2, 0, 5}, {133, 7, 1, 6}, {125, 1, 0, 6}, {163, 10, 0, 7},
+		{60, 3, 0, 5}, {122, 3, 0, 6}, {118, 1, 0, 6}, {163, 7, 1, 7}, {101, 2, 0, 6}, {161, 7, 1, 7}, {145, 1, 0, 7}, {183, 10, 0, 8},
+		{9, 6, 0, 3}, {33, 6, 0, 4}, {37, 6, 0, 4}, {69, 1, 1, 5}, {38, 6, 0, 4}, {80, 6, 0, 5}, {72, 6, 0, 5}, {109, 2, 1, 6},
+		{36, 3, 0, 4}, {82, 6, 0, 5}, {82, 7, 1, 5}, {129, 6, 0, 6}, {71, 2, 0, 5}, {131, 7, 1, 6}, {113, 1, 0, 6}, {155, 7, 1, 7},
+		{30, 4, 0, 4}, {78, 4, 0, 5}, {81, 7, 1, 5}, {130, 1, 1, 6}, {76, 2, 0, 5}, {134, 7, 1, 6}, {126, 1, 0, 6}, {166, 7, 1, 7},
+		{64, 3, 0, 5}, {127, 3, 0, 6}, {125, 7, 1, 6}, {169, 7, 1, 7}, {107, 2, 0, 6}, {164, 7, 1, 7}, {152, 1, 0, 7}, {185, 7, 1, 8},
+		{22, 5, 0, 4}, {62, 5, 0, 5}, {68, 5, 0, 5}, {111, 5, 0, 6}, {66, 2, 0, 5}, {124, 5, 0, 6}, {113, 7, 1, 6}, {158, 7, 1, 7},
+		{58, 3, 0, 5}, {122, 7, 1, 6}, {120, 7, 1, 6}, {167, 7, 1, 7}, {106, 2, 0, 6}, {165, 7, 1, 7}, {153, 1, 0, 7}, {187, 7, 1, 8},
+		{51, 4, 0, 5}, {103, 4, 0, 6}, {105, 4, 0, 6}, {157, 7, 1, 7}, {99, 2, 0, 6}, {162, 7, 1, 7}, {152, 7, 1, 7}, {189, 7, 1, 8},
+		{89, 3, 0, 6}, {147, 3, 0, 7}, {145, 7, 1, 7}, {186, 7, 1, 8}, {138, 2, 0, 7}, {184, 7, 1, 8}, {176, 1, 0, 8}, {204, 7, 1, 9},
+		{2, 8, 0, 2}, {12, 8, 0, 3}, {13, 8, 0, 3}, {29, 1, 1, 4}, {14, 8, 0, 3}, {40, 8, 0, 4}, {33, 2, 1, 4}, {56, 2, 1, 5},
+		{15, 8, 0, 3}, {41, 8, 0, 4}, {42, 8, 0, 4}, {73, 3, 1, 5}, {35, 3, 1, 4}, {74, 3, 1, 5}, {62, 3, 1, 5}, {97, 3, 1, 6},
+		{14, 10, 1, 3}, {43, 8, 0, 4}, {46, 8, 0, 4}, {76, 8, 0, 5}, {44, 2, 0, 4}, {83, 8, 0, 5}, {78, 4, 1, 5}, {115, 4, 1, 6},
+		{35, 3, 0, 4}, {80, 4, 1, 5}, {79, 4, 1, 5}, {119, 4, 1, 6}, {63, 2, 0, 5}, {116, 4, 1, 6}, {103, 4, 1, 6}, {144, 4, 1, 7},
+		{13, 10, 1, 3}, {41, 0, 1, 4}, {45, 5, 0, 4}, {77, 1, 1, 5}, {46, 10, 1, 4}, {84, 8, 0, 5}, {82, 2, 1, 5}, {120, 2, 1, 6},
+		{42, 3, 0, 4}, {85, 8, 0, 5}, {85, 1, 0, 5}, {132, 8, 0, 6}, {79, 2, 0, 5}, {133, 5, 1, 6}, {122, 1, 0, 6}, {161, 5, 1, 7},
+		{33, 4, 0, 4}, {80, 4, 0, 5}, {82, 4, 0, 5}, {131, 5, 1, 6}, {78, 2, 0, 5}, {134, 5, 1, 6}, {127, 1, 0, 6}, {164, 5, 1, 7},
+		{62, 3, 0, 5}, {124, 3, 0, 6}, {122, 5, 1, 6}, {165, 5, 1, 7}, {103, 2, 0, 6}, {162, 5, 1, 7}, {147, 1, 0, 7}, {184, 5, 1, 8},
+		{12, 6, 0, 3}, {40, 6, 0, 4}, {41, 6, 0, 4}, {74, 1, 1, 5}, {43, 6, 0, 4}, {83, 6, 0, 5}, {80, 2, 1, 5}, {116, 2, 1, 6},
+		{41, 10, 1, 4}, {84, 6, 0, 5}, {85, 6, 0, 5}, {133, 3, 1, 6}, {80, 2, 0, 5}, {134, 3, 1, 6}, {124, 1, 0, 6}, {162, 3, 1, 7},
+		{40, 4, 0, 4}, {83, 4, 0, 5}, {84, 4, 0, 5}, {134, 1, 1, 6}, {83, 2, 0, 5}, {135, 0, 0, 6}, {134, 1, 0, 6}, {171, 0, 0, 7},
+		{74, 3, 0, 5}, {134, 3, 0, 6}, {133, 1, 0, 6}, {172, 0, 0, 7}, {116, 2, 0, 6}, {171, 2, 0, 7}, {162, 1, 0, 7}, {195, 0, 0, 8},
+		{29, 5, 0, 4}, {74, 5, 0, 5}, {77, 5, 0, 5}, {123, 5, 0, 6}, {76, 10, 1, 5}, {134, 5, 0, 6}, {131, 1, 0, 6}, {168, 2, 1, 7},
+		{73, 3, 0, 5}, {133, 3, 0, 6}, {132, 1, 0, 6}, {173, 0, 0, 7}, {119, 2, 0, 6}, {172, 2, 0, 7}, {165, 1, 0, 7}, {196, 0, 0, 8},
+		{56, 4, 0, 5}, {116, 4, 0, 6}, {120, 4, 0, 6}, {168, 4, 0, 7}, {115, 2, 0, 6}, {171, 4, 0, 7}, {164, 1, 0, 7}, {198, 0, 0, 8},
+		{97, 3, 0, 6}, {162, 3, 0, 7}, {161, 1, 0, 7}, {196, 6, 1, 8}, {144, 2, 0, 7}, {195, 2, 0, 8}, {184, 1, 0, 8}, {208, 0, 0, 9},
+		{8, 7, 0, 3}, {29, 7, 0, 4}, {31, 7, 0, 4}, {59, 7, 0, 5}, {34, 7, 0, 4}, {74, 7, 0, 5}, {69, 7, 0, 5}, {102, 2, 1, 6},
+		{32, 10, 1, 4}, {77, 7, 0, 5}, {79, 7, 0, 5}, {121, 7, 0, 6}, {70, 2, 0, 5}, {123, 7, 0, 6}, {111, 3, 1, 6}, {150, 3, 1, 7},
+		{30, 10, 1, 4}, {76, 0, 1, 5}, {81, 7, 0, 5}, {126, 7, 0, 6}, {78, 10, 1, 5}, {134, 7, 0, 6}, {130, 1, 0, 6}, {166, 7, 0, 7},
+		{67, 3, 0, 5}, {131, 3, 0, 6}, {128, 1, 0, 6}, {170, 4, 1, 7}, {110, 2, 0, 6}, {168, 4, 1, 7}, {157, 1, 0, 7}, {188, 4, 1, 8},
+		{28, 5, 0, 4}, {73, 5, 0, 5}, {75, 5, 0, 5}, {121, 1, 1, 6}, {75, 10, 1, 5}, {133, 5, 0, 6}, {129, 1, 0, 6}, {167, 2, 1, 7},
+		{73, 10, 1, 5}, {132, 3, 0, 6}, {133, 10, 1, 6}, {173, 7, 0, 7}, {121, 2, 0, 6}, {173, 2, 0, 7}, {167, 1, 0, 7}, {197, 0, 0, 8},
+		{57, 4, 0, 5}, {119, 4, 0, 6}, {125, 4, 0, 6}, {170, 4, 0, 7}, {117, 2, 0, 6}, {172, 4, 0, 7}, {169, 1, 0, 7}, {201, 0, 0, 8},
+		{100, 3, 0, 6}, {165, 3, 0, 7}, {163, 1, 0, 7}, {200, 0, 0, 8}, {148, 2, 0, 7}, {196, 2, 0, 8}, {186, 1, 0, 8}, {209, 0, 0, 9},
+		{20, 6, 0, 4}, {56, 6, 0, 5}, {60, 6, 0, 5}, {102, 6, 0, 6}, {61, 6, 0, 5}, {116, 6, 0, 6}, {109, 6, 0, 6}, {151, 6, 0, 7},
+		{58, 10, 1, 5}, {120, 6, 0, 6}, {122, 6, 0, 6}, {167, 6, 0, 7}, {108, 2, 0, 6}, {168, 6, 0, 7}, {158, 1, 0, 7}, {190, 3, 1, 8},
+		{55, 4, 0, 5}, {115, 4, 0, 6}, {118, 4, 0, 6}, {166, 1, 1, 7}, {115, 10, 1, 6}, {171, 6, 0, 7}, {166, 1, 0, 7}, {199, 0, 0, 8},
+		{98, 3, 0, 6}, {164, 3, 0, 7}, {163, 10, 1, 7}, {201, 8, 1, 8}, {149, 2, 0, 7}, {198, 2, 0, 8}, {189, 1, 0, 8}, {210, 0, 0, 9},
+		{49, 5, 0, 5}, {97, 5, 0, 6}, {101, 5, 0, 6}, {150, 5, 0, 7}, {99, 10, 1, 6}, {162, 5, 0, 7}, {155, 1, 0, 7}, {190, 5, 0, 8},
+		{96, 3, 0, 6}, {161, 3, 0, 7}, {161, 10, 1, 7}, {197, 5, 0, 8}, {146, 2, 0, 7}, {196, 8, 1, 8}, {187, 1, 0, 8}, {211, 0, 0, 9},
+		{87, 4, 0, 6}, {144, 4, 0, 7}, {145, 4, 0, 7}, {188, 4, 0, 8}, {143, 2, 0, 7}, {195, 4, 0, 8}, {185, 1, 0, 8}, {210, 8, 1, 9},
+		{137, 3, 0, 7}, {184, 3, 0, 8}, {183, 1, 0, 8}, {209, 8, 1, 9}, {175, 2, 0, 8}, {208, 2, 0, 9}, {204, 1, 0, 9}, {216, 0, 0, 10},
+		{1, 9, 0, 2}, {8, 9, 0, 3}, {9, 9, 0, 3}, {21, 9, 0, 4}, {10, 9, 0, 3}, {29, 9, 0, 4}, {25, 9, 0, 4}, {50, 2, 1, 5},
+		{11, 9, 0, 3}, {31, 9, 0, 4}, {33, 9, 0, 4}, {57, 9, 0, 5}, {26, 9, 0, 4}, {59, 9, 0, 5}, {53, 3, 1, 5}, {88, 3, 1, 6},
+		{11, 10, 1, 3}, {34, 9, 0, 4}, {37, 9, 0, 4}, {64, 9, 0, 5}, {35, 9, 0, 4}, {74, 9, 0, 5}, {67, 9, 0, 5}, {98, 9, 0, 6},
+		{27, 3, 0, 4}, {69, 9, 0, 5}, {69, 4, 1, 5}, {104, 9, 0, 6}, {54, 4, 1, 5}, {102, 4, 1, 6}, {92, 4, 1, 6}, {139, 4, 1, 7},
+		{10, 10, 1, 3}, {32, 0, 1, 4}, {38, 9, 0, 4}, {65, 9, 0, 5}, {39, 9, 0, 4}, {77, 9, 0, 5}, {71, 9, 0, 5}, {106, 9, 0, 6},
+		{35, 10, 1, 4}, {79, 9, 0, 5}, {80, 9, 0, 5}, {119, 9, 0, 6}, {70, 9, 0, 5}, {121, 9, 0, 6}, {108, 9, 0, 6}, {146, 9, 0, 7},
+		{26, 4, 0, 4}, {70, 4, 0, 5}, {72, 9, 0, 5}, {112, 9, 0, 6}, {70, 10, 1, 5}, {123, 9, 0, 6}, {112, 5, 1, 6}, {154, 9, 0, 7},
+		{54, 3, 0, 5}, {111, 5, 1, 6}, {109, 5, 1, 6}, {156, 5, 1, 7}, {94, 2, 0, 6}, {150, 5, 1, 7}, {141, 5, 1, 7}, {177, 5, 1, 8},
+		{9, 10, 1, 3}, {30, 0, 1, 4}, {36, 6, 0, 4}, {64, 1, 1, 5}, {38, 10, 1, 4}, {76, 2, 1, 5}, {71, 2, 1, 5}, {107, 2, 1, 6},
+		{37, 10, 1, 4}, {81, 9, 0, 5}, {82, 9, 0, 5}, {125, 9, 0, 6}, {72, 2, 0, 5}, {126, 9, 0, 6}, {113, 3, 1, 6}, {152, 3, 1, 7},
+		{33, 10, 1, 4}, {78, 0, 1, 5}, {82, 10, 1, 5}, {127, 9, 0, 6}, {80, 10, 1, 5}, {134, 9, 0, 6}, {131, 9, 0, 6}, {164, 9, 0, 7},
+		{69, 3, 0, 5}, {130, 3, 0, 6}, {129, 9, 0, 6}, {169, 9, 0, 7}, {109, 2, 0, 6}, {166, 9, 0, 7}, {155, 9, 0, 7}, {185, 9, 0, 8},
+		{25, 5, 0, 4}, {67, 5, 0, 5}, {71, 5, 0, 5}, {112, 1, 1, 6}, {71, 10, 1, 5}, {131, 5, 0, 6}, {114, 1, 0, 6}, {159, 2, 1, 7},
+		{67, 10, 1, 5}, {128, 3, 0, 6}, {131, 10, 1, 6}, {170, 9, 0, 7}, {112, 2, 0, 6}, {170, 6, 1, 7}, {159, 1, 0, 7}, {191, 9, 0, 8},
+		{53, 4, 0, 5}, {110, 4, 0, 6}, {113, 4, 0, 6}, {160, 4, 0, 7}, {108, 10, 1, 6}, {168, 6, 1, 7}, {159, 6, 1, 7}, {193, 6, 1, 8},
+		{92, 3, 0, 6}, {157, 3, 0, 7}, {155, 10, 1, 7}, {192, 6, 1, 8}, {141, 2, 0, 7}, {188, 6, 1, 8}, {180, 1, 0, 8}, {205, 6, 1, 9},
+		{8, 10, 1, 3}, {28, 7, 0, 4}, {30, 7, 0, 4}, {57, 1, 1, 5}, {32, 7, 0, 4}, {73, 7, 0, 5}, {67, 2, 1, 5}, {100, 2, 1, 6},
+		{34, 10, 1, 4}, {75, 7, 0, 5}, {78, 7, 0, 5}, {117, 7, 0, 6}, {70, 3, 1, 5}, {121, 3, 1, 6}, {110, 3, 1, 6}, {148, 3, 1, 7},
+		{31, 10, 1, 4}, {75, 0, 1, 5}, {81, 10, 1, 5}, {125, 1, 1, 6}, {79, 10, 1, 5}, {133, 7, 0, 6}, {128, 7, 0, 6}, {163, 4, 1, 7},
+		{69, 10, 1, 5}, {129, 3, 0, 6}, {130, 4, 1, 6}, {169, 4, 1, 7}, {111, 2, 0, 6}, {167, 4, 1, 7}, {157, 4, 1, 7}, {186, 4, 1, 8},
+		{29, 10, 1, 4}, {73, 0, 1, 5}, {76, 5, 0, 5}, {119, 1, 1, 6}, {77, 10, 1, 5}, {132, 5, 0, 6}, {131, 2, 1, 6}, {165, 2, 1, 7},
+		{74, 10, 1, 5}, {133, 0, 1, 6}, {134, 10, 1, 6}, {172, 9, 0, 7}, {123, 2, 0, 6}, {173, 9, 0, 7}, {168, 1, 0, 7}, {196, 3, 1, 8},
+		{59, 4, 0, 5}, {121, 4, 0, 6}, {126, 4, 0, 6}, {170, 1, 1, 7}, {121, 10, 1, 6}, {173, 4, 0, 7}, {170, 1, 0, 7}, {200, 9, 0, 8},
+		{102, 3, 0, 6}, {167, 3, 0, 7}, {166, 10, 1, 7}, {201, 5, 1, 8}, {150, 2, 0, 7}, {197, 2, 0, 8}, {188, 1, 0, 8}, {209, 5, 1, 9},
+		{21, 6, 0, 4}, {57, 6, 0, 5}, {64, 6, 0, 5}, {104, 6, 0, 6}, {65, 6, 0, 5}, {119, 6, 0, 6}, {112, 6, 0, 6}, {156, 2, 1, 7},
+		{64, 10, 1, 5}, {125, 6, 0, 6}, {127, 6, 0, 6}, {169, 6, 0, 7}, {112, 10, 1, 6}, {170, 6, 0, 7}, {160, 1, 0, 7}, {192, 3, 1, 8},
+		{57, 10, 1, 5}, {117, 4, 0, 6}, {125, 10, 1, 6}, {169, 1, 1, 7}, {119, 10, 1, 6}, {172, 6, 0, 7}, {170, 10, 1, 7}, {201, 2, 1, 8},
+		{104, 3, 0, 6}, {169, 3, 0, 7}, {169, 10, 1, 7}, {202, 0, 0, 8}, {156, 2, 0, 7}, {201, 2, 0, 8}, {192, 1, 0, 8}, {212, 0, 0, 9},
+		{50, 5, 0, 5}, {100, 5, 0, 6}, {107, 5, 0, 6}, {156, 5, 0, 7}, {106, 10, 1, 6}, {165, 5, 0, 7}, {159, 5, 0, 7}, {194, 5, 0, 8},
+		{98, 10, 1, 6}, {163, 3, 0, 7}, {164, 10, 1, 7}, {201, 5, 0, 8}, {154, 2, 0, 7}, {200, 2, 0, 8}, {193, 1, 0, 8}, {213, 0, 0, 9},
+		{88, 4, 0, 6}, {148, 4, 0, 7}, {152, 4, 0, 7}, {192, 4, 0, 8}, {146, 10, 1, 7}, {196, 4, 0, 8}, {191, 1, 0, 8}, {213, 7, 1, 9},
+		{139, 3, 0, 7}, {186, 3, 0, 8}, {185, 10, 1, 8}, {212, 3, 0, 9}, {177, 2, 0, 8}, {209, 2, 0, 9}, {205, 1, 0, 9}, {217, 0, 0, 10},
+		{7, 8, 0, 3}, {20, 8, 0, 4}, {22, 8, 0, 4}, {50, 8, 0, 5}, {23, 8, 0, 4}, {56, 8, 0, 5}, {53, 8, 0, 5}, {90, 8, 0, 6},
+		{24, 8, 0, 4}, {60, 8, 0, 5}, {62, 8, 0, 5}, {100, 8, 0, 6}, {54, 8, 0, 5}, {102, 8, 0, 6}, {93, 8, 0, 6}, {140, 3, 1, 7},
+		{23, 10, 1, 4}, {61, 8, 0, 5}, {68, 8, 0, 5}, {107, 8, 0, 6}, {63, 8, 0, 5}, {116, 8, 0, 6}, {110, 8, 0, 6}, {149, 8, 0, 7},
+		{54, 10, 1, 5}, {109, 8, 0, 6}, {111, 8, 0, 6}, {156, 8, 0, 7}, {95, 2, 0, 6}, {151, 8, 0, 7}, {142, 4, 1, 7}, {178, 4, 1, 8},
+		{22, 10, 1, 4}, {58, 0, 1, 5}, {66, 5, 0, 5}, {106, 1, 1, 6}, {68, 10, 1, 5}, {120, 8, 0, 6}, {113, 8, 0, 6}, {153, 8, 0, 7},
+		{62, 10, 1, 5}, {122, 8, 0, 6}, {124, 8, 0, 6}, {165, 8, 0, 7}, {111, 10, 1, 6}, {167, 8, 0, 7}, {158, 8, 0, 7}, {187, 8, 0, 8},
+		{53, 10, 1, 5}, {108, 4, 0, 6}, {113, 10, 1, 6}, {159, 8, 0, 7}, {110, 10, 1, 6}, {168, 8, 0, 7}, {160, 8, 0, 7}, {193, 8, 0, 8},
+		{93, 3, 0, 6}, {158, 3, 0, 7}, {158, 10, 1, 7}, {194, 8, 0, 8}, {142, 2, 0, 7}, {190, 5, 1, 8}, {181, 1, 0, 8}, {206, 5, 1, 9},
+		{20, 10, 1, 4}, {55, 6, 0, 5}, {58, 6, 0, 5}, {98, 1, 1, 6}, {61, 10, 1, 5}, {115, 6, 0, 6}, {108, 2, 1, 6}, {149, 2, 1, 7},
+		{60, 10, 1, 5}, {118, 6, 0, 6}, {122, 10, 1, 6}, {163, 6, 0, 7}, {109, 10, 1, 6}, {166, 3, 1, 7}, {158, 3, 1, 7}, {189, 3, 1, 8},
+		{56, 10, 1, 5}, {115, 0, 1, 6}, {120, 10, 1, 6}, {164, 1, 1, 7}, {116, 10, 1, 6}, {171, 8, 0, 7}, {168, 10, 1, 7}, {198, 8, 0, 8},
+		{102, 10, 1, 6}, {166, 3, 0, 7}, {167, 10, 1, 7}, {201, 8, 0, 8}, {151, 2, 0, 7}, {199, 2, 0, 8}, {190, 1, 0, 8}, {210, 4, 1, 9},
+		{50, 10, 1, 5}, {98, 5, 0, 6}, {106, 5, 0, 6}, {154, 5, 0, 7}, {107, 10, 1, 6}, {164, 5, 0, 7}, {159, 10, 1, 7}, {193, 2, 1, 8},
+		{100, 10, 1, 6}, {163, 0, 1, 7}, {165, 10, 1, 7}, {200, 5, 0, 8}, {156, 10, 1, 7}, {201, 10, 1, 8}, {194, 1, 0, 8}, {213, 3, 1, 9},
+		{90, 4, 0, 6}, {149, 4, 0, 7}, {153, 4, 0, 7}, {193, 4, 0, 8}, {149, 10, 1, 7}, {198, 4, 0, 8}, {193, 10, 1, 8}, {214, 0, 0, 9},
+		{140, 3, 0, 7}, {189, 3, 0, 8}, {187, 10, 1, 8}, {213, 3, 0, 9}, {178, 2, 0, 8}, {210, 2, 0, 9}, {206, 1, 0, 9}, {218, 0, 0, 10},
+		{19, 7, 0, 4}, {49, 7, 0, 5}, {51, 7, 0, 5}, {88, 7, 0, 6}, {52, 7, 0, 5}, {97, 7, 0, 6}, {92, 7, 0, 6}, {140, 7, 0, 7},
+		{52, 10, 1, 5}, {101, 7, 0, 6}, {103, 7, 0, 6}, {148, 7, 0, 7}, {94, 7, 0, 6}, {150, 7, 0, 7}, {142, 7, 0, 7}, {179, 7, 0, 8},
+		{51, 10, 1, 5}, {99, 0, 1, 6}, {105, 7, 0, 6}, {152, 7, 0, 7}, {103, 10, 1, 6}, {162, 7, 0, 7}, {157, 7, 0, 7}, {189, 7, 0, 8},
+		{92, 10, 1, 6}, {155, 3, 0, 7}, {157, 10, 1, 7}, {192, 7, 0, 8}, {142, 10, 1, 7}, {190, 7, 0, 8}, {182, 1, 0, 8}, {207, 4, 1, 9},
+		{49, 10, 1, 5}, {96, 5, 0, 6}, {99, 5, 0, 6}, {146, 1, 1, 7}, {101, 10, 1, 6}, {161, 5, 0, 7}, {155, 2, 1, 7}, {187, 2, 1, 8},
+		{97, 10, 1, 6}, {161, 0, 1, 7}, {162, 10, 1, 7}, {196, 7, 0, 8}, {150, 10, 1, 7}, {197, 7, 0, 8}, {190, 10, 1, 8}, {211, 7, 0, 9},
+		{88, 10, 1, 6}, {146, 4, 0, 7}, {152, 10, 1, 7}, {191, 4, 0, 8}, {148, 10, 1, 7}, {196, 10, 1, 8}, {192, 10, 1, 8}, {213, 7, 0, 9},
+		{140, 10, 1, 7}, {187, 3, 0, 8}, {189, 10, 1, 8}, {213, 10, 1, 9}, {179, 2, 0, 8}, {211, 2, 0, 9}, {207, 1, 0, 9}, {219, 0, 0, 10},
+		{48, 6, 0, 5}, {87, 6, 0, 6}, {89, 6, 0, 6}, {139, 6, 0, 7}, {91, 6, 0, 6}, {144, 6, 0, 7}, {141, 6, 0, 7}, {178, 6, 0, 8},
+		{89, 10, 1, 6}, {145, 6, 0, 7}, {147, 6, 0, 7}, {186, 6, 0, 8}, {141, 10, 1, 7}, {188, 6, 0, 8}, {181, 6, 0, 8}, {207, 6, 0, 9},
+		{87, 10, 1, 6}, {143, 4, 0, 7}, {145, 10, 1, 7}, {185, 1, 1, 8}, {144, 10, 1, 7}, {195, 6, 0, 8}, {188, 10, 1, 8}, {210, 6, 0, 9},
+		{139, 10, 1, 7}, {185, 3, 0, 8}, {186, 10, 1, 8}, {212, 6, 0, 9}, {178, 10, 1, 8}, {210, 10, 1, 9}, {207, 10, 1, 9}, {220, 0, 0, 10},
+		{86, 5, 0, 6}, {137, 5, 0, 7}, {138, 5, 0, 7}, {177, 5, 0, 8}, {138, 10, 1, 7}, {184, 5, 0, 8}, {180, 5, 0, 8}, {206, 5, 0, 9},
+		{137, 10, 1, 7}, {183, 3, 0, 8}, {184, 10, 1, 8}, {209, 5, 0, 9}, {177, 10, 1, 8}, {209, 10, 1, 9}, {206, 10, 1, 9}, {219, 5, 0, 10},
+		{136, 4, 0, 7}, {175, 4, 0, 8}, {176, 4, 0, 8}, {205, 4, 0, 9}, {175, 10, 1, 8}, {208, 4, 0, 9}, {205, 10, 1, 9}, {218, 4, 0, 10},
+		{174, 3, 0, 8}, {204, 3, 0, 9}, {204, 10, 1, 9}, {217, 3, 0, 10}, {203, 2, 0, 9}, {216, 2, 0, 10}, {215, 1, 0, 10}, {221, 0, 0, 11},
+		{0, 11, 0, 1}, {1, 11, 0, 2}, {2, 11, 0, 2}, {7, 11, 0, 3}, {3, 11, 0, 2}, {8, 11, 0, 3}, {8, 2, 1, 3}, {19, 11, 0, 4},
+		{4, 11, 0, 2}, {9, 11, 0, 3}, {12, 11, 0, 3}, {20, 11, 0, 4}, {9, 3, 1, 3}, {21, 11, 0, 4}, {20, 3, 1, 4}, {48, 11, 0, 5},
+		{5, 11, 0, 2}, {10, 11, 0, 3}, {13, 11, 0, 3}, {22, 11, 0, 4}, {13, 4, 1, 3}, {29, 11, 0, 4}, {28, 11, 0, 4}, {49, 11, 0, 5},
+		{10, 4, 1, 3}, {25, 11, 0, 4}, {29, 4, 1, 4}, {50, 11, 0, 5}, {22, 4, 1, 4}, {50, 4, 1, 5}, {49, 4, 1, 5}, {86, 11, 0, 6},
+		{6, 5, 0, 2}, {11, 11, 0, 3}, {14, 11, 0, 3}, {23, 11, 0, 4}, {16, 11, 0, 3}, {31, 11, 0, 4}, {30, 11, 0, 4}, {51, 11, 0, 5},
+		{14, 5, 1, 3}, {33, 11, 0, 4}, {40, 11, 0, 4}, {56, 11, 0, 5}, {30, 5, 1, 4}, {57, 11, 0, 5}, {55, 11, 0, 5}, {87, 11, 0, 6},
+		{11, 5, 1, 3}, {26, 11, 0, 4}, {33, 5, 1, 4}, {53, 11, 0, 5}, {31, 5, 1, 4}, {59, 11, 0, 5}, {57, 5, 1, 5}, {88, 11, 0, 6},
+		{23, 5, 1, 4}, {53, 5, 1, 5}, {56, 5, 1, 5}, {90, 11, 0, 6}, {51, 5, 1, 5}, {88, 5, 1, 6}, {87, 5, 1, 6}, {136, 11, 0, 7},
+		{5, 6, 0, 2}, {11, 0, 1, 3}, {15, 11, 0, 3}, {24, 11, 0, 4}, {17, 11, 0, 3}, {34, 11, 0, 4}, {32, 11, 0, 4}, {52, 11, 0, 5},
+		{17, 6, 1, 3}, {37, 11, 0, 4}, {41, 11, 0, 4}, {60, 11, 0, 5}, {36, 11, 0, 4}, {64, 11, 0, 5}, {58, 11, 0, 5}, {89, 11, 0, 6},
+		{15, 4, 0, 3}, {35, 11, 0, 4}, {42, 11, 0, 4}, {62, 11, 0, 5}, {41, 6, 1, 4}, {74, 11, 0, 5}, {73, 11, 0, 5}, {97, 11, 0, 6},
+		{32, 6, 1, 4}, {67, 11, 0, 5}, {73, 6, 1, 5}, {100, 11, 0, 6}, {58, 6, 1, 5}, {98, 11, 0, 6}, {96, 11, 0, 6}, {137, 11, 0, 7},
+		{11, 5, 0, 3}, {27, 5, 0, 4}, {35, 6, 1, 4}, {54, 11, 0, 5}, {37, 6, 1, 4}, {69, 11, 0, 5}, {67, 6, 1, 5}, {92, 11, 0, 6},
+		{34, 6, 1, 4}, {69, 6, 1, 5}, {74, 6, 1, 5}, {102, 11, 0, 6}, {64, 6, 1, 5}, {104, 11, 0, 6}, {98, 6, 1, 6}, {139, 11, 0, 7},
+		{24, 4, 0, 4}, {54, 6, 1, 5}, {62, 6, 1, 5}, {93, 11, 0, 6}, {60, 6, 1, 5}, {102, 6, 1, 6}, {100, 6, 1, 6}, {140, 11, 0, 7},
+		{52, 6, 1, 5}, {92, 6, 1, 6}, {97, 6, 1, 6}, {140, 6, 1, 7}, {89, 6, 1, 6}, {139, 6, 1, 7}, {137, 6, 1, 7}, {174, 11, 0, 8},
+		{4, 7, 0, 2}, {10, 0, 1, 3}, {14, 1, 1, 3}, {23, 1, 1, 4}, {17, 2, 1, 3}, {32, 2, 1, 4}, {34, 2, 1, 4}, {52, 2, 1, 5},
+		{18, 3, 0, 3}, {38, 11, 0, 4}, {43, 11, 0, 4}, {61, 11, 0, 5}, {38, 3, 1, 4}, {65, 11, 0, 5}, {61, 3, 1, 5}, {91, 11, 0, 6},
+		{17, 4, 0, 3}, {39, 11, 0, 4}, {46, 11, 0, 4}, {68, 11, 0, 5}, {45, 11, 0, 4}, {77, 11, 0, 5}, {75, 11, 0, 5}, {101, 11, 0, 6},
+		{38, 3, 0, 4}, {71, 11, 0, 5}, {76, 11, 0, 5}, {107, 11, 0, 6}, {66, 11, 0, 5}, {106, 11, 0, 6}, {99, 11, 0, 6}, {138, 11, 0, 7},
+		{14, 5, 0, 3}, {35, 0, 1, 4}, {44, 5, 0, 4}, {63, 11, 0, 5}, {46, 7, 1, 4}, {79, 11, 0, 5}, {78, 11, 0, 5}, {103, 11, 0, 6},
+		{43, 3, 0, 4}, {80, 11, 0, 5}, {83, 11, 0, 5}, {116, 11, 0, 6}, {76, 7, 1, 5}, {119, 11, 0, 6}, {115, 11, 0, 6}, {144, 11, 0, 7},
+		{34, 4, 0, 4}, {70, 11, 0, 5}, {78, 7, 1, 5}, {110, 11, 0, 6}, {75, 7, 1, 5}, {121, 11, 0, 6}, {117, 11, 0, 6}, {148, 11, 0, 7},
+		{61, 3, 0, 5}, {108, 11, 0, 6}, {115, 7, 1, 6}, {149, 11, 0, 7}, {99, 7, 1, 6}, {146, 11, 0, 7}, {143, 11, 0, 7}, {175, 11, 0, 8},
+		{10, 6, 0, 3}, {26, 6, 0, 4}, {35, 6, 0, 4}, {54, 1, 1, 5}, {39, 6, 0, 4}, {70, 6, 0, 5}, {70, 7, 1, 5}, {94, 11, 0, 6},
+		{38, 7, 1, 4}, {72, 11, 0, 5}, {80, 7, 1, 5}, {109, 11, 0, 6}, {71, 7, 1, 5}, {112, 11, 0, 6}, {108, 7, 1, 6}, {141, 11, 0, 7},
+		{32, 4, 0, 4}, {70, 0, 1, 5}, {79, 7, 1, 5}, {111, 11, 0, 6}, {77, 7, 1, 5}, {123, 11, 0, 6}, {121, 7, 1, 6}, {150, 11, 0, 7},
+		{65, 3, 0, 5}, {112, 7, 1, 6}, {119, 7, 1, 6}, {156, 11, 0, 7}, {106, 7, 1, 6}, {154, 11, 0, 7}, {146, 7, 1, 7}, {177, 11, 0, 8},
+		{23, 5, 0, 4}, {54, 5, 0, 5}, {63, 5, 0, 5}, {95, 5, 0, 6}, {68, 7, 1, 5}, {111, 7, 1, 6}, {110, 7, 1, 6}, {142, 11, 0, 7},
+		{61, 7, 1, 5}, {109, 7, 1, 6}, {116, 7, 1, 6}, {151, 11, 0, 7}, {107, 7, 1, 6}, {156, 7, 1, 7}, {149, 7, 1, 7}, {178, 11, 0, 8},
+		{52, 4, 0, 5}, {94, 4, 0, 6}, {103, 7, 1, 6}, {142, 7, 1, 7}, {101, 7, 1, 6}, {150, 7, 1, 7}, {148, 7, 1, 7}, {179, 11, 0, 8},
+		{91, 3, 0, 6}, {141, 7, 1, 7}, {144, 7, 1, 7}, {178, 7, 1, 8}, {138, 7, 1, 7}, {177, 7, 1, 8}, {175, 7, 1, 8}, {203, 11, 0, 9},
+		{3, 8, 0, 2}, {9, 0, 1, 3}, {13, 1, 1, 3}, {22, 1, 1, 4}, {16, 8, 0, 3}, {30, 2, 1, 4}, {31, 2, 1, 4}, {51, 2, 1, 5},
+		{17, 8, 0, 3}, {36, 8, 0, 4}, {41, 3, 1, 4}, {58, 3, 1, 5}, {37, 3, 1, 4}, {64, 3, 1, 5}, {60, 3, 1, 5}, {89, 3, 1, 6},
+		{17, 11, 1, 3}, {38, 0, 1, 4}, {45, 8, 0, 4}, {66, 8, 0, 5}, {46, 4, 1, 4}, {76, 4, 1, 5}, {75, 4, 1, 5}, {99, 4, 1, 6},
+		{39, 3, 0, 4}, {71, 4, 1, 5}, {77, 4, 1, 5}, {106, 4, 1, 6}, {68, 4, 1, 5}, {107, 4, 1, 6}, {101, 4, 1, 6}, {138, 4, 1, 7},
+		{16, 5, 0, 3}, {37, 0, 1, 4}, {46, 1, 1, 4}, {68, 1, 1, 5}, {47, 2, 0, 4}, {81, 11, 0, 5}, {81, 2, 1, 5}, {105, 11, 0, 6},
+		{46, 3, 0, 4}, {82, 11, 0, 5}, {84, 11, 0, 5}, {120, 11, 0, 6}, {81, 2, 0, 5}, {125, 11, 0, 6}, {118, 11, 0, 6}, {145, 11, 0, 7},
+		{37, 4, 0, 4}, {72, 4, 0, 5}, {82, 5, 1, 5}, {113, 11, 0, 6}, {81, 5, 1, 5}, {126, 11, 0, 6}, {125, 5, 1, 6}, {152, 11, 0, 7},
+		{68, 3, 0, 5}, {113, 5, 1, 6}, {120, 5, 1, 6}, {153, 11, 0, 7}, {105, 2, 0, 6}, {152, 5, 1, 7}, {145, 5, 1, 7}, {176, 11, 0, 8},
+		{13, 6, 0, 3}, {33, 0, 1, 4}, {42, 6, 0, 4}, {62, 1, 1, 5}, {46, 6, 0, 4}, {78, 2, 1, 5}, {79, 2, 1, 5}, {103, 2, 1, 6},
+		{45, 3, 0, 4}, {82, 0, 1, 5}, {85, 11, 0, 5}, {122, 11, 0, 6}, {82, 2, 0, 5}, {127, 11, 0, 6}, {122, 3, 1, 6}, {147, 11, 0, 7},
+		{41, 4, 0, 4}, {80, 0, 1, 5}, {85, 4, 0, 5}, {124, 11, 0, 6}, {84, 2, 0, 5}, {134, 11, 0, 6}, {133, 11, 0, 6}, {162, 11, 0, 7},
+		{77, 3, 0, 5}, {131, 11, 0, 6}, {132, 11, 0, 6}, {165, 11, 0, 7}, {120, 2, 0, 6}, {164, 11, 0, 7}, {161, 11, 0, 7}, {184, 11, 0, 8},
+		{31, 5, 0, 4}, {69, 5, 0, 5}, {79, 5, 0, 5}, {111, 1, 1, 6}, {81, 5, 0, 5}, {130, 5, 0, 6}, {128, 11, 0, 6}, {157, 11, 0, 7},
+		{75, 3, 0, 5}, {129, 11, 0, 6}, {133, 8, 1, 6}, {167, 11, 0, 7}, {125, 2, 0, 6}, {169, 11, 0, 7}, {163, 11, 0, 7}, {186, 11, 0, 8},
+		{60, 4, 0, 5}, {109, 4, 0, 6}, {122, 4, 0, 6}, {158, 11, 0, 7}, {118, 2, 0, 6}, {166, 11, 0, 7}, {163, 8, 1, 7}, {189, 11, 0, 8},
+		{101, 3, 0, 6}, {155, 11, 0, 7}, {161, 8, 1, 7}, {187, 11, 0, 8}, {145, 2, 0, 7}, {185, 11, 0, 8}, {183, 11, 0, 8}, {204, 11, 0, 9},
+		{9, 7, 0, 3}, {25, 7, 0, 4}, {33, 7, 0, 4}, {53, 1, 1, 5}, {37, 7, 0, 4}, {67, 7, 0, 5}, {69, 2, 1, 5}, {92, 2, 1, 6},
+		{38, 7, 0, 4}, {71, 7, 0, 5}, {80, 7, 0, 5}, {108, 7, 0, 6}, {72, 7, 0, 5}, {112, 3, 1, 6}, {109, 3, 1, 6}, {141, 3, 1, 7},
+		{36, 4, 0, 4}, {71, 0, 1, 5}, {82, 7, 0, 5}, {113, 1, 1, 6}, {82, 8, 1, 5}, {131, 7, 0, 6}, {129, 7, 0, 6}, {155, 7, 0, 7},
+		{71, 3, 0, 5}, {114, 3, 0, 6}, {131, 8, 1, 6}, {159, 11, 0, 7}, {113, 2, 0, 6}, {159, 4, 1, 7}, {155, 8, 1, 7}, {180, 11, 0, 8},
+		{30, 5, 0, 4}, {67, 0, 1, 5}, {78, 5, 0, 5}, {110, 1, 1, 6}, {81, 8, 1, 5}, {128, 5, 0, 6}, {130, 2, 1, 6}, {157, 2, 1, 7},
+		{76, 3, 0, 5}, {131, 0, 1, 6}, {134, 8, 1, 6}, {168, 11, 0, 7}, {126, 2, 0, 6}, {170, 11, 0, 7}, {166, 8, 1, 7}, {188, 11, 0, 8},
+		{64, 4, 0, 5}, {112, 4, 0, 6}, {127, 4, 0, 6}, {160, 11, 0, 7}, {125, 8, 1, 6}, {170, 8, 1, 7}, {169, 8, 1, 7}, {192, 11, 0, 8},
+		{107, 3, 0, 6}, {159, 3, 0, 7}, {164, 8, 1, 7}, {193, 11, 0, 8}, {152, 2, 0, 7}, {191, 11, 0, 8}, {185, 8, 1, 8}, {205, 11, 0, 9},
+		{22, 6, 0, 4}, {53, 6, 0, 5}, {62, 6, 0, 5}, {93, 6, 0, 6}, {68, 6, 0, 5}, {110, 6, 0, 6}, {111, 6, 0, 6}, {142, 2, 1, 7},
+		{66, 3, 0, 5}, {113, 6, 0, 6}, {124, 6, 0, 6}, {158, 6, 0, 7}, {113, 8, 1, 6}, {160, 6, 0, 7}, {158, 8, 1, 7}, {181, 11, 0, 8},
+		{58, 4, 0, 5}, {108, 0, 1, 6}, {122, 8, 1, 6}, {158, 1, 1, 7}, {120, 8, 1, 6}, {168, 8, 1, 7}, {167, 8, 1, 7}, {190, 11, 0, 8},
+		{106, 3, 0, 6}, {159, 8, 1, 7}, {165, 8, 1, 7}, {194, 11, 0, 8}, {153, 2, 0, 7}, {193, 8, 1, 8}, {187, 8, 1, 8}, {206, 11, 0, 9},
+		{51, 5, 0, 5}, {92, 5, 0, 6}, {103, 5, 0, 6}, {142, 5, 0, 7}, {105, 5, 0, 6}, {157, 5, 0, 7}, {157, 8, 1, 7}, {182, 5, 0, 8},
+		{99, 3, 0, 6}, {155, 0, 1, 7}, {162, 8, 1, 7}, {190, 8, 1, 8}, {152, 8, 1, 7}, {192, 8, 1, 8}, {189, 8, 1, 8}, {207, 11, 0, 9},
+		{89, 4, 0, 6}, {141, 4, 0, 7}, {147, 4, 0, 7}, {181, 4, 0, 8}, {145, 8, 1, 7}, {188, 8, 1, 8}, {186, 8, 1, 8}, {207, 8, 1, 9},
+		{138, 3, 0, 7}, {180, 3, 0, 8}, {184, 8, 1, 8}, {206, 8, 1, 9}, {176, 2, 0, 8}, {205, 8, 1, 9}, {204, 8, 1, 9}, {215, 11, 0, 10},
+		{2, 9, 0, 2}, {8, 0, 1, 3}, {12, 9, 0, 3}, {20, 1, 1, 4}, {13, 9, 0, 3}, {28, 9, 0, 4}, {29, 2, 1, 4}, {49, 2, 1, 5},
+		{14, 9, 0, 3}, {30, 9, 0, 4}, {40, 9, 0, 4}, {55, 9, 0, 5}, {33, 3, 1, 4}, {57, 3, 1, 5}, {56, 3, 1, 5}, {87, 3, 1, 6},
+		{15, 9, 0, 3}, {32, 9, 0, 4}, {41, 9, 0, 4}, {58, 9, 0, 5}, {42, 9, 0, 4}, {73, 9, 0, 5}, {73, 4, 1, 5}, {96, 9, 0, 6},
+		{35, 4, 1, 4}, {67, 4, 1, 5}, {74, 4, 1, 5}, {98, 4, 1, 6}, {62, 4, 1, 5}, {100, 4, 1, 6}, {97, 4, 1, 6}, {137, 4, 1, 7},
+		{14, 11, 1, 3}, {34, 0, 1, 4}, {43, 9, 0, 4}, {61, 1, 1, 5}, {46, 9, 0, 4}, {75, 9, 0, 5}, {76, 9, 0, 5}, {99, 9, 0, 6},
+		{44, 3, 0, 4}, {78, 9, 0, 5}, {83, 9, 0, 5}, {115, 9, 0, 6}, {78, 5, 1, 5}, {117, 9, 0, 6}, {115, 5, 1, 6}, {143, 9, 0, 7},
+		{35, 4, 0, 4}, {70, 5, 1, 5}, {80, 5, 1, 5}, {108, 5, 1, 6}, {79, 5, 1, 5}, {121, 5, 1, 6}, {119, 5, 1, 6}, {146, 5, 1, 7},
+		{63, 3, 0, 5}, {110, 5, 1, 6}, {116, 5, 1, 6}, {149, 5, 1, 7}, {103, 5, 1, 6}, {148, 5, 1, 7}, {144, 5, 1, 7}, {175, 5, 1, 8},
+		{13, 11, 1, 3}, {31, 0, 1, 4}, {41, 1, 1, 4}, {60, 1, 1, 5}, {45, 6, 0, 4}, {75, 2, 1, 5}, {77, 2, 1, 5}, {101, 2, 1, 6},
+		{46, 11, 1, 4}, {81, 0, 1, 5}, {84, 9, 0, 5}, {118, 9, 0, 6}, {82, 3, 1, 5}, {125, 3, 1, 6}, {120, 3, 1, 6}, {145, 3, 1, 7},
+		{42, 4, 0, 4}, {79, 0, 1, 5}, {85, 9, 0, 5}, {122, 1, 1, 6}, {85, 2, 0, 5}, {133, 9, 0, 6}, {132, 9, 0, 6}, {161, 9, 0, 7},
+		{79, 3, 0, 5}, {128, 9, 0, 6}, {133, 6, 1, 6}, {163, 9, 0, 7}, {122, 2, 0, 6}, {163, 6, 1, 7}, {161, 6, 1, 7}, {183, 9, 0, 8},
+		{33, 5, 0, 4}, {69, 0, 1, 5}, {80, 5, 0, 5}, {109, 1, 1, 6}, {82, 5, 0, 5}, {129, 5, 0, 6}, {131, 6, 1, 6}, {155, 6, 1, 7},
+		{78, 3, 0, 5}, {130, 0, 1, 6}, {134, 6, 1, 6}, {166, 6, 1, 7}, {127, 2, 0, 6}, {169, 6, 1, 7}, {164, 6, 1, 7}, {185, 6, 1, 8},
+		{62, 4, 0, 5}, {111, 4, 0, 6}, {124, 4, 0, 6}, {158, 6, 1, 7}, {122, 6, 1, 6}, {167, 6, 1, 7}, {165, 6, 1, 7}, {187, 6, 1, 8},
+		{103, 3, 0, 6}, {157, 6, 1, 7}, {162, 6, 1, 7}, {189, 6, 1, 8}, {147, 2, 0, 7}, {186, 6, 1, 8}, {184, 6, 1, 8}, {204, 6, 1, 9},
+		{12, 7, 0, 3}, {29, 0, 1, 4}, {40, 7, 0, 4}, {56, 1, 1, 5}, {41, 7, 0, 4}, {73, 2, 1, 5}, {74, 2, 1, 5}, {97, 2, 1, 6},
+		{43, 7, 0, 4}, {76, 7, 0, 5}, {83, 7, 0, 5}, {115, 3, 1, 6}, {80, 3, 1, 5}, {119, 3, 1, 6}, {116, 3, 1, 6}, {144, 3, 1, 7},
+		{41, 11, 1, 4}, {77, 0, 1, 5}, {84, 7, 0, 5}, {120, 1, 1, 6}, {85, 7, 0, 5}, {132, 7, 0, 6}, {133, 4, 1, 6}, {161, 4, 1, 7},
+		{80, 3, 0, 5}, {131, 4, 1, 6}, {134, 4, 1, 6}, {164, 4, 1, 7}, {124, 2, 0, 6}, {165, 4, 1, 7}, {162, 4, 1, 7}, {184, 4, 1, 8},
+		{40, 5, 0, 4}, {74, 0, 1, 5}, {83, 5, 0, 5}, {116, 1, 1, 6}, {84, 5, 0, 5}, {133, 2, 1, 6}, {134, 2, 1, 6}, {162, 2, 1, 7},
+		{83, 3, 0, 5}, {134, 0, 1, 6}, {135, 1, 0, 6}, {171, 11, 0, 7}, {134, 2, 0, 6}, {172, 11, 0, 7}, {171, 1, 0, 7}, {195, 11, 0, 8},
+		{74, 4, 0, 5}, {123, 4, 0, 6}, {134, 4, 0, 6}, {168, 1, 1, 7}, {133, 2, 0, 6}, {173, 11, 0, 7}, {172, 1, 0, 7}, {196, 11, 0, 8},
+		{116, 3, 0, 6}, {168, 3, 0, 7}, {171, 3, 0, 7}, {198, 11, 0, 8}, {162, 2, 0, 7}, {196, 5, 1, 8}, {195, 1, 0, 8}, {208, 11, 0, 9},
+		{29, 6, 0, 4}, {59, 6, 0, 5}, {74, 6, 0, 5}, {102, 1, 1, 6}, {77, 6, 0, 5}, {121, 6, 0, 6}, {123, 6, 0, 6}, {150, 2, 1, 7},
+		{76, 11, 1, 5}, {126, 6, 0, 6}, {134, 6, 0, 6}, {166, 6, 0, 7}, {131, 2, 0, 6}, {170, 3, 1, 7}, {168, 3, 1, 7}, {188, 3, 1, 8},
+		{73, 4, 0, 5}, {121, 0, 1, 6}, {133, 4, 0, 6}, {167, 1, 1, 7}, {132, 2, 0, 6}, {173, 6, 0, 7}, {173, 1, 0, 7}, {197, 11, 0, 8},
+		{119, 3, 0, 6}, {170, 3, 0, 7}, {172, 3, 0, 7}, {201, 11, 0, 8}, {165, 2, 0, 7}, {200, 11, 0, 8}, {196, 1, 0, 8}, {209, 11, 0, 9},
+		{56, 5, 0, 5}, {102, 5, 0, 6}, {116, 5, 0, 6}, {151, 5, 0, 7}, {120, 5, 0, 6}, {167, 5, 0, 7}, {168, 5, 0, 7}, {190, 2, 1, 8},
+		{115, 3, 0, 6}, {166, 0, 1, 7}, {171, 5, 0, 7}, {199, 5, 0, 8}, {164, 2, 0, 7}, {201, 7, 1, 8}, {198, 1, 0, 8}, {210, 11, 0, 9},
+		{97, 4, 0, 6}, {150, 4, 0, 7}, {162, 4, 0, 7}, {190, 4, 0, 8}, {161, 2, 0, 7}, {197, 4, 0, 8}, {196, 7, 1, 8}, {211, 11, 0, 9},
+		{144, 3, 0, 7}, {188, 3, 0, 8}, {195, 3, 0, 8}, {210, 7, 1, 9}, {184, 2, 0, 8}, {209, 7, 1, 9}, {208, 1, 0, 9}, {216, 11, 0, 10},
+		{8, 8, 0, 3}, {21, 8, 0, 4}, {29, 8, 0, 4}, {50, 1, 1, 5}, {31, 8, 0, 4}, {57, 8, 0, 5}, {59, 8, 0, 5}, {88, 2, 1, 6},
+		{34, 8, 0, 4}, {64, 8, 0, 5}, {74, 8, 0, 5}, {98, 8, 0, 6}, {69, 8, 0, 5}, {104, 8, 0, 6}, {102, 3, 1, 6}, {139, 3, 1, 7},
+		{32, 11, 1, 4}, {65, 8, 0, 5}, {77, 8, 0, 5}, {106, 8, 0, 6}, {79, 8, 0, 5}, {119, 8, 0, 6}, {121, 8, 0, 6}, {146, 8, 0, 7},
+		{70, 3, 0, 5}, {112, 8, 0, 6}, {123, 8, 0, 6}, {154, 8, 0, 7}, {111, 4, 1, 6}, {156, 4, 1, 7}, {150, 4, 1, 7}, {177, 4, 1, 8},
+		{30, 11, 1, 4}, {64, 0, 1, 5}, {76, 1, 1, 5}, {107, 1, 1, 6}, {81, 8, 0, 5}, {125, 8, 0, 6}, {126, 8, 0, 6}, {152, 2, 1, 7},
+		{78, 11, 1, 5}, {127, 8, 0, 6}, {134, 8, 0, 6}, {164, 8, 0, 7}, {130, 2, 0, 6}, {169, 8, 0, 7}, {166, 8, 0, 7}, {185, 8, 0, 8},
+		{67, 4, 0, 5}, {112, 0, 1, 6}, {131, 4, 0, 6}, {159, 1, 1, 7}, {128, 2, 0, 6}, {170, 8, 0, 7}, {170, 5, 1, 7}, {191, 8, 0, 8},
+		{110, 3, 0, 6}, {160, 3, 0, 7}, {168, 5, 1, 7}, {193, 5, 1, 8}, {157, 2, 0, 7}, {192, 5, 1, 8}, {188, 5, 1, 8}, {205, 5, 1, 9},
+		{28, 6, 0, 4}, {57, 0, 1, 5}, {73, 6, 0, 5}, {100, 1, 1, 6}, {75, 6, 0, 5}, {117, 6, 0, 6}, {121, 2, 1, 6}, {148, 2, 1, 7},
+		{75, 11, 1, 5}, {125, 0, 1, 6}, {133, 6, 0, 6}, {163, 3, 1, 7}, {129, 2, 0, 6}, {169, 3, 1, 7}, {167, 3, 1, 7}, {186, 3, 1, 8},
+		{73, 11, 1, 5}, {119, 0, 1, 6}, {132, 4, 0, 6}, {165, 1, 1, 7}, {133, 11, 1, 6}, {172, 8, 0, 7}, {173, 8, 0, 7}, {196, 2, 1, 8},
+		{121, 3, 0, 6}, {170, 0, 1, 7}, {173, 3, 0, 7}, {200, 8, 0, 8}, {167, 2, 0, 7}, {201, 4, 1, 8}, {197, 1, 0, 8}, {209, 4, 1, 9},
+		{57, 5, 0, 5}, {104, 5, 0, 6}, {119, 5, 0, 6}, {156, 1, 1, 7}, {125, 5, 0, 6}, {169, 5, 0, 7}, {170, 5, 0, 7}, {192, 2, 1, 8},
+		{117, 3, 0, 6}, {169, 0, 1, 7}, {172, 5, 0, 7}, {201, 1, 1, 8}, {169, 2, 0, 7}, {202, 2, 0, 8}, {201, 1, 0, 8}, {212, 11, 0, 9},
+		{100, 4, 0, 6}, {156, 4, 0, 7}, {165, 4, 0, 7}, {194, 4, 0, 8}, {163, 2, 0, 7}, {201, 4, 0, 8}, {200, 1, 0, 8}, {213, 11, 0, 9},
+		{148, 3, 0, 7}, {192, 3, 0, 8}, {196, 3, 0, 8}, {213, 6, 1, 9}, {186, 2, 0, 8}, {212, 2, 0, 9}, {209, 1, 0, 9}, {217, 11, 0, 10},
+		{20, 7, 0, 4}, {50, 7, 0, 5}, {56, 7, 0, 5}, {90, 7, 0, 6}, {60, 7, 0, 5}, {100, 7, 0, 6}, {102, 7, 0, 6}, {140, 2, 1, 7},
+		{61, 7, 0, 5}, {107, 7, 0, 6}, {116, 7, 0, 6}, {149, 7, 0, 7}, {109, 7, 0, 6}, {156, 7, 0, 7}, {151, 7, 0, 7}, {178, 3, 1, 8},
+		{58, 11, 1, 5}, {106, 0, 1, 6}, {120, 7, 0, 6}, {153, 7, 0, 7}, {122, 7, 0, 6}, {165, 7, 0, 7}, {167, 7, 0, 7}, {187, 7, 0, 8},
+		{108, 3, 0, 6}, {159, 7, 0, 7}, {168, 7, 0, 7}, {193, 7, 0, 8}, {158, 2, 0, 7}, {194, 7, 0, 8}, {190, 4, 1, 8}, {206, 4, 1, 9},
+		{55, 5, 0, 5}, {98, 0, 1, 6}, {115, 5, 0, 6}, {149, 1, 1, 7}, {118, 5, 0, 6}, {163, 5, 0, 7}, {166, 2, 1, 7}, {189, 2, 1, 8},
+		{115, 11, 1, 6}, {164, 0, 1, 7}, {171, 7, 0, 7}, {198, 7, 0, 8}, {166, 2, 0, 7}, {201, 7, 0, 8}, {199, 1, 0, 8}, {210, 3, 1, 9},
+		{98, 4, 0, 6}, {154, 4, 0, 7}, {164, 4, 0, 7}, {193, 1, 1, 8}, {163, 11, 1, 7}, {200, 4, 0, 8}, {201, 9, 1, 8}, {213, 2, 1, 9},
+		{149, 3, 0, 7}, {193, 3, 0, 8}, {198, 3, 0, 8}, {214, 3, 0, 9}, {189, 2, 0, 8}, {213, 2, 0, 9}, {210, 1, 0, 9}, {218, 11, 0, 10},
+		{49, 6, 0, 5}, {88, 6, 0, 6}, {97, 6, 0, 6}, {140, 6, 0, 7}, {101, 6, 0, 6}, {148, 6, 0, 7}, {150, 6, 0, 7}, {179, 6, 0, 8},
+		{99, 11, 1, 6}, {152, 6, 0, 7}, {162, 6, 0, 7}, {189, 6, 0, 8}, {155, 2, 0, 7}, {192, 6, 0, 8}, {190, 6, 0, 8}, {207, 3, 1, 9},
+		{96, 4, 0, 6}, {146, 0, 1, 7}, {161, 4, 0, 7}, {187, 1, 1, 8}, {161, 11, 1, 7}, {196, 6, 0, 8}, {197, 6, 0, 8}, {211, 6, 0, 9},
+		{146, 3, 0, 7}, {191, 3, 0, 8}, {196, 9, 1, 8}, {213, 6, 0, 9}, {187, 2, 0, 8}, {213, 9, 1, 9}, {211, 1, 0, 9}, {219, 11, 0, 10},
+		{87, 5, 0, 6}, {139, 5, 0, 7}, {144, 5, 0, 7}, {178, 5, 0, 8}, {145, 5, 0, 7}, {186, 5, 0, 8}, {188, 5, 0, 8}, {207, 5, 0, 9},
+		{143, 3, 0, 7}, {185, 0, 1, 8}, {195, 5, 0, 8}, {210, 5, 0, 9}, {185, 2, 0, 8}, {212, 5, 0, 9}, {210, 9, 1, 9}, {220, 5, 0, 10},
+		{137, 4, 0, 7}, {177, 4, 0, 8}, {184, 4, 0, 8}, {206, 4, 0, 9}, {183, 2, 0, 8}, {209, 4, 0, 9}, {209, 9, 1, 9}, {219, 4, 0, 10},
+		{175, 3, 0, 8}, {205, 3, 0, 9}, {208, 3, 0, 9}, {218, 3, 0, 10}, {204, 2, 0, 9}, {217, 2, 0, 10}, {216, 1, 0, 10}, {221, 11, 0, 11},
+		{1, 10, 0, 2}, {7, 10, 0, 3}, {8, 10, 0, 3}, {19, 10, 0, 4}, {9, 10, 0, 3}, {20, 10, 0, 4}, {21, 10, 0, 4}, {48, 10, 0, 5},
+		{10, 10, 0, 3}, {22, 10, 0, 4}, {29, 10, 0, 4}, {49, 10, 0, 5}, {25, 10, 0, 4}, {50, 10, 0, 5}, {50, 3, 1, 5}, {86, 10, 0, 6},
+		{11, 10, 0, 3}, {23, 10, 0, 4}, {31, 10, 0, 4}, {51, 10, 0, 5}, {33, 10, 0, 4}, {56, 10, 0, 5}, {57, 10, 0, 5}, {87, 10, 0, 6},
+		{26, 10, 0, 4}, {53, 10, 0, 5}, {59, 10, 0, 5}, {88, 10, 0, 6}, {53, 4, 1, 5}, {90, 10, 0, 6}, {88, 4, 1, 6}, {136, 10, 0, 7},
+		{11, 11, 1, 3}, {24, 10, 0, 4}, {34, 10, 0, 4}, {52, 10, 0, 5}, {37, 10, 0, 4}, {60, 10, 0, 5}, {64, 10, 0, 5}, {89, 10, 0, 6},
+		{35, 10, 0, 4}, {62, 10, 0, 5}, {74, 10, 0, 5}, {97, 10, 0, 6}, {67, 10, 0, 5}, {100, 10, 0, 6}, {98, 10, 0, 6}, {137, 10, 0, 7},
+		{27, 4, 0, 4}, {54, 10, 0, 5}, {69, 10, 0, 5}, {92, 10, 0, 6}, {69, 5, 1, 5}, {102, 10, 0, 6}, {104, 10, 0, 6}, {139, 10, 0, 7},
+		{54, 5, 1, 5}, {93, 10, 0, 6}, {102, 5, 1, 6}, {140, 10, 0, 7}, {92, 5, 1, 6}, {140, 5, 1, 7}, {139, 5, 1, 7}, {174, 10, 0, 8},
+		{10, 11, 1, 3}, {23, 0, 1, 4}, {32, 1, 1, 4}, {52, 1, 1, 5}, {38, 10, 0, 4}, {61, 10, 0, 5}, {65, 10, 0, 5}, {91, 10, 0, 6},
+		{39, 10, 0, 4}, {68, 10, 0, 5}, {77, 10, 0, 5}, {101, 10, 0, 6}, {71, 10, 0, 5}, {107, 10, 0, 6}, {106, 10, 0, 6}, {138, 10, 0, 7},
+		{35, 11, 1, 4}, {63, 10, 0, 5}, {79, 10, 0, 5}, {103, 10, 0, 6}, {80, 10, 0, 5}, {116, 10, 0, 6}, {119, 10, 0, 6}, {144, 10, 0, 7},
+		{70, 10, 0, 5}, {110, 10, 0, 6}, {121, 10, 0, 6}, {148, 10, 0, 7}, {108, 10, 0, 6}, {149, 10, 0, 7}, {146, 10, 0, 7}, {175, 10, 0, 8},
+		{26, 5, 0, 4}, {54, 0, 1, 5}, {70, 5, 0, 5}, {94, 10, 0, 6}, {72, 10, 0, 5}, {109, 10, 0, 6}, {112, 10, 0, 6}, {141, 10, 0, 7},
+		{70, 11, 1, 5}, {111, 10, 0, 6}, {123, 10, 0, 6}, {150, 10, 0, 7}, {112, 6, 1, 6}, {156, 10, 0, 7}, {154, 10, 0, 7}, {177, 10, 0, 8},
+		{54, 4, 0, 5}, {95, 4, 0, 6}, {111, 6, 1, 6}, {142, 10, 0, 7}, {109, 6, 1, 6}, {151, 10, 0, 7}, {156, 6, 1, 7}, {178, 10, 0, 8},
+		{94, 3, 0, 6}, {142, 6, 1, 7}, {150, 6, 1, 7}, {179, 10, 0, 8}, {141, 6, 1, 7}, {178, 6, 1, 8}, {177, 6, 1, 8}, {203, 10, 0, 9},
+		{9, 11, 1, 3}, {22, 0, 1, 4}, {30, 1, 1, 4}, {51, 1, 1, 5}, {36, 7, 0, 4}, {58, 2, 1, 5}, {64, 2, 1, 5}, {89, 2, 1, 6},
+		{38, 11, 1, 4}, {66, 7, 0, 5}, {76, 3, 1, 5}, {99, 3, 1, 6}, {71, 3, 1, 5}, {106, 3, 1, 6}, {107, 3, 1, 6}, {138, 3, 1, 7},
+		{37, 11, 1, 4}, {68, 0, 1, 5}, {81, 10, 0, 5}, {105, 10, 0, 6}, {82, 10, 0, 5}, {120, 10, 0, 6}, {125, 10, 0, 6}, {145, 10, 0, 7},
+		{72, 3, 0, 5}, {113, 10, 0, 6}, {126, 10, 0, 6}, {152, 10, 0, 7}, {113, 4, 1, 6}, {153, 10, 0, 7}, {152, 4, 1, 7}, {176, 10, 0, 8},
+		{33, 11, 1, 4}, {62, 0, 1, 5}, {78, 1, 1, 5}, {103, 1, 1, 6}, {82, 11, 1, 5}, {122, 10, 0, 6}, {127, 10, 0, 6}, {147, 10, 0, 7},
+		{80, 11, 1, 5}, {124, 10, 0, 6}, {134, 10, 0, 6}, {162, 10, 0, 7}, {131, 10, 0, 6}, {165, 10, 0, 7}, {164, 10, 0, 7}, {184, 10, 0, 8},
+		{69, 4, 0, 5}, {111, 0, 1, 6}, {130, 4, 0, 6}, {157, 10, 0, 7}, {129, 10, 0, 6}, {167, 10, 0, 7}, {169, 10, 0, 7}, {186, 10, 0, 8},
+		{109, 3, 0, 6}, {158, 10, 0, 7}, {166, 10, 0, 7}, {189, 10, 0, 8}, {155, 10, 0, 7}, {187, 10, 0, 8}, {185, 10, 0, 8}, {204, 10, 0, 9},
+		{25, 6, 0, 4}, {53, 0, 1, 5}, {67, 6, 0, 5}, {92, 1, 1, 6}, {71, 6, 0, 5}, {108, 6, 0, 6}, {112, 2, 1, 6}, {141, 2, 1, 7},
+		{71, 11, 1, 5}, {113, 0, 1, 6}, {131, 6, 0, 6}, {155, 6, 0, 7}, {114, 2, 0, 6}, {159, 10, 0, 7}, {159, 3, 1, 7}, {180, 10, 0, 8},
+		{67, 11, 1, 5}, {110, 0, 1, 6}, {128, 4, 0, 6}, {157, 1, 1, 7}, {131, 11, 1, 6}, {168, 10, 0, 7}, {170, 10, 0, 7}, {188, 10, 0, 8},
+		{112, 3, 0, 6}, {160, 10, 0, 7}, {170, 7, 1, 7}, {192, 10, 0, 8}, {159, 2, 0, 7}, {193, 10, 0, 8}, {191, 10, 0, 8}, {205, 10, 0, 9},
+		{53, 5, 0, 5}, {93, 5, 0, 6}, {110, 5, 0, 6}, {142, 1, 1, 7}, {113, 5, 0, 6}, {158, 5, 0, 7}, {160, 5, 0, 7}, {181, 10, 0, 8},
+		{108, 11, 1, 6}, {158, 0, 1, 7}, {168, 7, 1, 7}, {190, 10, 0, 8}, {159, 7, 1, 7}, {194, 10, 0, 8}, {193, 7, 1, 8}, {206, 10, 0, 9},
+		{92, 4, 0, 6}, {142, 4, 0, 7}, {157, 4, 0, 7}, {182, 4, 0, 8}, {155, 11, 1, 7}, {190, 7, 1, 8}, {192, 7, 1, 8}, {207, 10, 0, 9},
+		{141, 3, 0, 7}, {181, 3, 0, 8}, {188, 7, 1, 8}, {207, 7, 1, 9}, {180, 2, 0, 8}, {206, 7, 1, 9}, {205, 7, 1, 9}, {215, 10, 0, 10},
+		{8, 11, 1, 3}, {20, 0, 1, 4}, {28, 8, 0, 4}, {49, 1, 1, 5}, {30, 8, 0, 4}, {55, 8, 0, 5}, {57, 2, 1, 5}, {87, 2, 1, 6},
+		{32, 8, 0, 4}, {58, 8, 0, 5}, {73, 8, 0, 5}, {96, 8, 0, 6}, {67, 3, 1, 5}, {98, 3, 1, 6}, {100, 3, 1, 6}, {137, 3, 1, 7},
+		{34, 11, 1, 4}, {61, 0, 1, 5}, {75, 8, 0, 5}, {99, 8, 0, 6}, {78, 8, 0, 5}, {115, 8, 0, 6}, {117, 8, 0, 6}, {143, 8, 0, 7},
+		{70, 4, 1, 5}, {108, 4, 1, 6}, {121, 4, 1, 6}, {146, 4, 1, 7}, {110, 4, 1, 6}, {149, 4, 1, 7}, {148, 4, 1, 7}, {175, 4, 1, 8},
+		{31, 11, 1, 4}, {60, 0, 1, 5}, {75, 1, 1, 5}, {101, 1, 1, 6}, {81, 11, 1, 5}, {118, 8, 0, 6}, {125, 2, 1, 6}, {145, 2, 1, 7},
+		{79, 11, 1, 5}, {122, 0, 1, 6}, {133, 8, 0, 6}, {161, 8, 0, 7}, {128, 8, 0, 6}, {163, 8, 0, 7}, {163, 5, 1, 7}, {183, 8, 0, 8},
+		{69, 11, 1, 5}, {109, 0, 1, 6}, {129, 4, 0, 6}, {155, 5, 1, 7}, {130, 5, 1, 6}, {166, 5, 1, 7}, {169, 5, 1, 7}, {185, 5, 1, 8},
+		{111, 3, 0, 6}, {158, 5, 1, 7}, {167, 5, 1, 7}, {187, 5, 1, 8}, {157, 5, 1, 7}, {189, 5, 1, 8}, {186, 5, 1, 8}, {204, 5, 1, 9},
+		{29, 11, 1, 4}, {56, 0, 1, 5}, {73, 1, 1, 5}, {97, 1, 1, 6}, {76, 6, 0, 5}, {115, 2, 1, 6}, {119, 2, 1, 6}, {144, 2, 1, 7},
+		{77, 11, 1, 5}, {120, 0, 1, 6}, {132, 6, 0, 6}, {161, 3, 1, 7}, {131, 3, 1, 6}, {164, 3, 1, 7}, {165, 3, 1, 7}, {184, 3, 1, 8},
+		{74, 11, 1, 5}, {116, 0, 1, 6}, {133, 1, 1, 6}, {162, 1, 1, 7}, {134, 11, 1, 6}, {171, 10, 0, 7}, {172, 10, 0, 7}, {195, 10, 0, 8},
+		{123, 3, 0, 6}, {168, 0, 1, 7}, {173, 10, 0, 7}, {196, 10, 0, 8}, {168, 2, 0, 7}, {198, 10, 0, 8}, {196, 4, 1, 8}, {208, 10, 0, 9},
+		{59, 5, 0, 5}, {102, 0, 1, 6}, {121, 5, 0, 6}, {150, 1, 1, 7}, {126, 5, 0, 6}, {166, 5, 0, 7}, {170, 2, 1, 7}, {188, 2, 1, 8},
+		{121, 11, 1, 6}, {167, 0, 1, 7}, {173, 5, 0, 7}, {197, 10, 0, 8}, {170, 2, 0, 7}, {201, 10, 0, 8}, {200, 10, 0, 8}, {209, 10, 0, 9},
+		{102, 4, 0, 6}, {151, 4, 0, 7}, {167, 4, 0, 7}, {190, 1, 1, 8}, {166, 11, 1, 7}, {199, 4, 0, 8}, {201, 6, 1, 8}, {210, 10, 0, 9},
+		{150, 3, 0, 7}, {190, 3, 0, 8}, {197, 3, 0, 8}, {211, 10, 0, 9}, {188, 2, 0, 8}, {210, 6, 1, 9}, {209, 6, 1, 9}, {216, 10, 0, 10},
+		{21, 7, 0, 4}, {50, 0, 1, 5}, {57, 7, 0, 5}, {88, 1, 1, 6}, {64, 7, 0, 5}, {98, 7, 0, 6}, {104, 7, 0, 6}, {139, 2, 1, 7},
+		{65, 7, 0, 5}, {106, 7, 0, 6}, {119, 7, 0, 6}, {146, 7, 0, 7}, {112, 7, 0, 6}, {154, 7, 0, 7}, {156, 3, 1, 7}, {177, 3, 1, 8},
+		{64, 11, 1, 5}, {107, 0, 1, 6}, {125, 7, 0, 6}, {152, 1, 1, 7}, {127, 7, 0, 6}, {164, 7, 0, 7}, {169, 7, 0, 7}, {185, 7, 0, 8},
+		{112, 11, 1, 6}, {159, 0, 1, 7}, {170, 7, 0, 7}, {191, 7, 0, 8}, {160, 2, 0, 7}, {193, 4, 1, 8}, {192, 4, 1, 8}, {205, 4, 1, 9},
+		{57, 11, 1, 5}, {100, 0, 1, 6}, {117, 5, 0, 6}, {148, 1, 1, 7}, {125, 11, 1, 6}, {163, 2, 1, 7}, {169, 2, 1, 7}, {186, 2, 1, 8},
+		{119, 11, 1, 6}, {165, 0, 1, 7}, {172, 7, 0, 7}, {196, 1, 1, 8}, {170, 11, 1, 7}, {200, 7, 0, 8}, {201, 3, 1, 8}, {209, 3, 1, 9},
+		{104, 4, 0, 6}, {156, 0, 1, 7}, {169, 4, 0, 7}, {192, 1, 1, 8}, {169, 11, 1, 7}, {201, 0, 1, 8}, {202, 1, 0, 8}, {212, 10, 0, 9},
+		{156, 3, 0, 7}, {194, 3, 0, 8}, {201, 3, 0, 8}, {213, 10, 0, 9}, {192, 2, 0, 8}, {213, 5, 1, 9}, {212, 1, 0, 9}, {217, 10, 0, 10},
+		{50, 6, 0, 5}, {90, 6, 0, 6}, {100, 6, 0, 6}, {140, 1, 1, 7}, {107, 6, 0, 6}, {149, 6, 0, 7}, {156, 6, 0, 7}, {178, 2, 1, 8},
+		{106, 11, 1, 6}, {153, 6, 0, 7}, {165, 6, 0, 7}, {187, 6, 0, 8}, {159, 6, 0, 7}, {193, 6, 0, 8}, {194, 6, 0, 8}, {206, 3, 1, 9},
+		{98, 11, 1, 6}, {149, 0, 1, 7}, {163, 4, 0, 7}, {189, 1, 1, 8}, {164, 11, 1, 7}, {198, 6, 0, 8}, {201, 6, 0, 8}, {210, 2, 1, 9},
+		{154, 3, 0, 7}, {193, 0, 1, 8}, {200, 3, 0, 8}, {213, 1, 1, 9}, {193, 2, 0, 8}, {214, 2, 0, 9}, {213, 1, 0, 9}, {218, 10, 0, 10},
+		{88, 5, 0, 6}, {140, 5, 0, 7}, {148, 5, 0, 7}, {179, 5, 0, 8}, {152, 5, 0, 7}, {189, 5, 0, 8}, {192, 5, 0, 8}, {207, 2, 1, 9},
+		{146, 11, 1, 7}, {187, 0, 1, 8}, {196, 5, 0, 8}, {211, 5, 0, 9}, {191, 2, 0, 8}, {213, 5, 0, 9}, {213, 8, 1, 9}, {219, 10, 0, 10},
+		{139, 4, 0, 7}, {178, 4, 0, 8}, {186, 4, 0, 8}, {207, 4, 0, 9}, {185, 11, 1, 8}, {210, 4, 0, 9}, {212, 4, 0, 9}, {220, 4, 0, 10},
+		{177, 3, 0, 8}, {206, 3, 0, 9}, {209, 3, 0, 9}, {219, 3, 0, 10}, {205, 2, 0, 9}, {218, 2, 0, 10}, {217, 1, 0, 10}, {221, 10, 0, 11},
+		{7, 9, 0, 3}, {19, 9, 0, 4}, {20, 9, 0, 4}, {48, 9, 0, 5}, {22, 9, 0, 4}, {49, 9, 0, 5}, {50, 9, 0, 5}, {86, 9, 0, 6},
+		{23, 9, 0, 4}, {51, 9, 0, 5}, {56, 9, 0, 5}, {87, 9, 0, 6}, {53, 9, 0, 5}, {88, 9, 0, 6}, {90, 9, 0, 6}, {136, 9, 0, 7},
+		{24, 9, 0, 4}, {52, 9, 0, 5}, {60, 9, 0, 5}, {89, 9, 0, 6}, {62, 9, 0, 5}, {97, 9, 0, 6}, {100, 9, 0, 6}, {137, 9, 0, 7},
+		{54, 9, 0, 5}, {92, 9, 0, 6}, {102, 9, 0, 6}, {139, 9, 0, 7}, {93, 9, 0, 6}, {140, 9, 0, 7}, {140, 4, 1, 7}, {174, 9, 0, 8},
+		{23, 11, 1, 4}, {52, 0, 1, 5}, {61, 9, 0, 5}, {91, 9, 0, 6}, {68, 9, 0, 5}, {101, 9, 0, 6}, {107, 9, 0, 6}, {138, 9, 0, 7},
+		{63, 9, 0, 5}, {103, 9, 0, 6}, {116, 9, 0, 6}, {144, 9, 0, 7}, {110, 9, 0, 6}, {148, 9, 0, 7}, {149, 9, 0, 7}, {175, 9, 0, 8},
+		{54, 11, 1, 5}, {94, 9, 0, 6}, {109, 9, 0, 6}, {141, 9, 0, 7}, {111, 9, 0, 6}, {150, 9, 0, 7}, {156, 9, 0, 7}, {177, 9, 0, 8},
+		{95, 3, 0, 6}, {142, 9, 0, 7}, {151, 9, 0, 7}, {178, 9, 0, 8}, {142, 5, 1, 7}, {179, 9, 0, 8}, {178, 5, 1, 8}, {203, 9, 0, 9},
+		{22, 11, 1, 4}, {51, 0, 1, 5}, {58, 1, 1, 5}, {89, 1, 1, 6}, {66, 6, 0, 5}, {99, 2, 1, 6}, {106, 2, 1, 6}, {138, 2, 1, 7},
+		{68, 11, 1, 5}, {105, 9, 0, 6}, {120, 9, 0, 6}, {145, 9, 0, 7}, {113, 9, 0, 6}, {152, 9, 0, 7}, {153, 9, 0, 7}, {176, 9, 0, 8},
+		{62, 11, 1, 5}, {103, 0, 1, 6}, {122, 9, 0, 6}, {147, 9, 0, 7}, {124, 9, 0, 6}, {162, 9, 0, 7}, {165, 9, 0, 7}, {184, 9, 0, 8},
+		{111, 11, 1, 6}, {157, 9, 0, 7}, {167, 9, 0, 7}, {186, 9, 0, 8}, {158, 9, 0, 7}, {189, 9, 0, 8}, {187, 9, 0, 8}, {204, 9, 0, 9},
+		{53, 11, 1, 5}, {92, 0, 1, 6}, {108, 5, 0, 6}, {141, 1, 1, 7}, {113, 11, 1, 6}, {155, 5, 0, 7}, {159, 9, 0, 7}, {180, 9, 0, 8},
+		{110, 11, 1, 6}, {157, 0, 1, 7}, {168, 9, 0, 7}, {188, 9, 0, 8}, {160, 9, 0, 7}, {192, 9, 0, 8}, {193, 9, 0, 8}, {205, 9, 0, 9},
+		{93, 4, 0, 6}, {142, 0, 1, 7}, {158, 4, 0, 7}, {181, 9, 0, 8}, {158, 11, 1, 7}, {190, 9, 0, 8}, {194, 9, 0, 8}, {206, 9, 0, 9},
+		{142, 3, 0, 7}, {182, 3, 0, 8}, {190, 6, 1, 8}, {207, 9, 0, 9}, {181, 2, 0, 8}, {207, 6, 1, 9}, {206, 6, 1, 9}, {215, 9, 0, 10},
+		{20, 11, 1, 4}, {49, 0, 1, 5}, {55, 7, 0, 5}, {87, 1, 1, 6}, {58, 7, 0, 5}, {96, 7, 0, 6}, {98, 2, 1, 6}, {137, 2, 1, 7},
+		{61, 11, 1, 5}, {99, 7, 0, 6}, {115, 7, 0, 6}, {143, 7, 0, 7}, {108, 3, 1, 6}, {146, 3, 1, 7}, {149, 3, 1, 7}, {175, 3, 1, 8},
+		{60, 11, 1, 5}, {101, 0, 1, 6}, {118, 7, 0, 6}, {145, 1, 1, 7}, {122, 11, 1, 6}, {161, 7, 0, 7}, {163, 7, 0, 7}, {183, 7, 0, 8},
+		{109, 11, 1, 6}, {155, 4, 1, 7}, {166, 4, 1, 7}, {185, 4, 1, 8}, {158, 4, 1, 7}, {187, 4, 1, 8}, {189, 4, 1, 8}, {204, 4, 1, 9},
+		{56, 11, 1, 5}, {97, 0, 1, 6}, {115, 1, 1, 6}, {144, 1, 1, 7}, {120, 11, 1, 6}, {161, 2, 1, 7}, {164, 2, 1, 7}, {184, 2, 1, 8},
+		{116, 11, 1, 6}, {162, 0, 1, 7}, {171, 9, 0, 7}, {195, 9, 0, 8}, {168, 11, 1, 7}, {196, 9, 0, 8}, {198, 9, 0, 8}, {208, 9, 0, 9},
+		{102, 11, 1, 6}, {150, 0, 1, 7}, {166, 4, 0, 7}, {188, 1, 1, 8}, {167, 11, 1, 7}, {197, 9, 0, 8}, {201, 9, 0, 8}, {209, 9, 0, 9},
+		{151, 3, 0, 7}, {190, 0, 1, 8}, {199, 3, 0, 8}, {210, 9, 0, 9}, {190, 2, 0, 8}, {211, 9, 0, 9}, {210, 5, 1, 9}, {216, 9, 0, 10},
+		{50, 11, 1, 5}, {88, 0, 1, 6}, {98, 6, 0, 6}, {139, 1, 1, 7}, {106, 6, 0, 6}, {146, 6, 0, 7}, {154, 6, 0, 7}, {177, 2, 1, 8},
+		{107, 11, 1, 6}, {152, 0, 1, 7}, {164, 6, 0, 7}, {185, 6, 0, 8}, {159, 11, 1, 7}, {191, 6, 0, 8}, {193, 3, 1, 8}, {205, 3, 1, 9},
+		{100, 11, 1, 6}, {148, 0, 1, 7}, {163, 1, 1, 7}, {186, 1, 1, 8}, {165, 11, 1, 7}, {196, 0, 1, 8}, {200, 6, 0, 8}, {209, 2, 1, 9},
+		{156, 11, 1, 7}, {192, 0, 1, 8}, {201, 11, 1, 8}, {212, 9, 0, 9}, {194, 2, 0, 8}, {213, 9, 0, 9}, {213, 4, 1, 9}, {217, 9, 0, 10},
+		{90, 5, 0, 6}, {140, 0, 1, 7}, {149, 5, 0, 7}, {178, 1, 1, 8}, {153, 5, 0, 7}, {187, 5, 0, 8}, {193, 5, 0, 8}, {206, 2, 1, 9},
+		{149, 11, 1, 7}, {189, 0, 1, 8}, {198, 5, 0, 8}, {210, 1, 1, 9}, {193, 11, 1, 8}, {213, 0, 1, 9}, {214, 1, 0, 9}, {218, 9, 0, 10},
+		{140, 4, 0, 7}, {179, 4, 0, 8}, {189, 4, 0, 8}, {207, 1, 1, 9}, {187, 11, 1, 8}, {211, 4, 0, 9}, {213, 4, 0, 9}, {219, 9, 0, 10},
+		{178, 3, 0, 8}, {207, 3, 0, 9}, {210, 3, 0, 9}, {220, 3, 0, 10}, {206, 2, 0, 9}, {219, 2, 0, 10}, {218, 1, 0, 10}, {221, 9, 0, 11},
+		{19, 8, 0, 4}, {48, 8, 0, 5}, {49, 8, 0, 5}, {86, 8, 0, 6}, {51, 8, 0, 5}, {87, 8, 0, 6}, {88, 8, 0, 6}, {136, 8, 0, 7},
+		{52, 8, 0, 5}, {89, 8, 0, 6}, {97, 8, 0, 6}, {137, 8, 0, 7}, {92, 8, 0, 6}, {139, 8, 0, 7}, {140, 8, 0, 7}, {174, 8, 0, 8},
+		{52, 11, 1, 5}, {91, 8, 0, 6}, {101, 8, 0, 6}, {138, 8, 0, 7}, {103, 8, 0, 6}, {144, 8, 0, 7}, {148, 8, 0, 7}, {175, 8, 0, 8},
+		{94, 8, 0, 6}, {141, 8, 0, 7}, {150, 8, 0, 7}, {177, 8, 0, 8}, {142, 8, 0, 7}, {178, 8, 0, 8}, {179, 8, 0, 8}, {203, 8, 0, 9},
+		{51, 11, 1, 5}, {89, 0, 1, 6}, {99, 1, 1, 6}, {138, 1, 1, 7}, {105, 8, 0, 6}, {145, 8, 0, 7}, {152, 8, 0, 7}, {176, 8, 0, 8},
+		{103, 11, 1, 6}, {147, 8, 0, 7}, {162, 8, 0, 7}, {184, 8, 0, 8}, {157, 8, 0, 7}, {186, 8, 0, 8}, {189, 8, 0, 8}, {204, 8, 0, 9},
+		{92, 11, 1, 6}, {141, 0, 1, 7}, {155, 4, 0, 7}, {180, 8, 0, 8}, {157, 11, 1, 7}, {188, 8, 0, 8}, {192, 8, 0, 8}, {205, 8, 0, 9},
+		{142, 11, 1, 7}, {181, 8, 0, 8}, {190, 8, 0, 8}, {206, 8, 0, 9}, {182, 2, 0, 8}, {207, 8, 0, 9}, {207, 5, 1, 9}, {215, 8, 0, 10},
+		{49, 11, 1, 5}, {87, 0, 1, 6}, {96, 6, 0, 6}, {137, 1, 1, 7}, {99, 6, 0, 6}, {143, 6, 0, 7}, {146, 2, 1, 7}, {175, 2, 1, 8},
+		{101, 11, 1, 6}, {145, 0, 1, 7}, {161, 6, 0, 7}, {183, 6, 0, 8}, {155, 3, 1, 7}, {185, 3, 1, 8}, {187, 3, 1, 8}, {204, 3, 1, 9},
+		{97, 11, 1, 6}, {144, 0, 1, 7}, {161, 1, 1, 7}, {184, 1, 1, 8}, {162, 11, 1, 7}, {195, 8, 0, 8}, {196, 8, 0, 8}, {208, 8, 0, 9},
+		{150, 11, 1, 7}, {188, 0, 1, 8}, {197, 8, 0, 8}, {209, 8, 0, 9}, {190, 11, 1, 8}, {210, 8, 0, 9}, {211, 8, 0, 9}, {216, 8, 0, 10},
+		{88, 11, 1, 6}, {139, 0, 1, 7}, {146, 5, 0, 7}, {177, 1, 1, 8}, {152, 11, 1, 7}, {185, 5, 0, 8}, {191, 5, 0, 8}, {205, 2, 1, 9},
+		{148, 11, 1, 7}, {186, 0, 1, 8}, {196, 11, 1, 8}, {209, 1, 1, 9}, {192, 11, 1, 8}, {212, 8, 0, 9}, {213, 8, 0, 9}, {217, 8, 0, 10},
+		{140, 11, 1, 7}, {178, 0, 1, 8}, {187, 4, 0, 8}, {206, 1, 1, 9}, {189, 11, 1, 8}, {210, 0, 1, 9}, {213, 11, 1, 9}, {218, 8, 0, 10},
+		{179, 3, 0, 8}, {207, 0, 1, 9}, {211, 3, 0, 9}, {219, 8, 0, 10}, {207, 2, 0, 9}, {220, 2, 0, 10}, {219, 1, 0, 10}, {221, 8, 0, 11},
+		{48, 7, 0, 5}, {86, 7, 0, 6}, {87, 7, 0, 6}, {136, 7, 0, 7}, {89, 7, 0, 6}, {137, 7, 0, 7}, {139, 7, 0, 7}, {174, 7, 0, 8},
+		{91, 7, 0, 6}, {138, 7, 0, 7}, {144, 7, 0, 7}, {175, 7, 0, 8}, {141, 7, 0, 7}, {177, 7, 0, 8}, {178, 7, 0, 8}, {203, 7, 0, 9},
+		{89, 11, 1, 6}, {138, 0, 1, 7}, {145, 7, 0, 7}, {176, 7, 0, 8}, {147, 7, 0, 7}, {184, 7, 0, 8}, {186, 7, 0, 8}, {204, 7, 0, 9},
+		{141, 11, 1, 7}, {180, 7, 0, 8}, {188, 7, 0, 8}, {205, 7, 0, 9}, {181, 7, 0, 8}, {206, 7, 0, 9}, {207, 7, 0, 9}, {215, 7, 0, 10},
+		{87, 11, 1, 6}, {137, 0, 1, 7}, {143, 5, 0, 7}, {175, 1, 1, 8}, {145, 11, 1, 7}, {183, 5, 0, 8}, {185, 2, 1, 8}, {204, 2, 1, 9},
+		{144, 11, 1, 7}, {184, 0, 1, 8}, {195, 7, 0, 8}, {208, 7, 0, 9}, {188, 11, 1, 8}, {209, 7, 0, 9}, {210, 7, 0, 9}, {216, 7, 0, 10},
+		{139, 11, 1, 7}, {177, 0, 1, 8}, {185, 4, 0, 8}, {205, 1, 1, 9}, {186, 11, 1, 8}, {209, 0, 1, 9}, {212, 7, 0, 9}, {217, 7, 0, 10},
+		{178, 11, 1, 8}, {206, 0, 1, 9}, {210, 11, 1, 9}, {218, 7, 0, 10}, {207, 11, 1, 9}, {219, 7, 0, 10}, {220, 1, 0, 10}, {221, 7, 0, 11},
+		{86, 6, 0, 6}, {136, 6, 0, 7}, {137, 6, 0, 7}, {174, 6, 0, 8}, {138, 6, 0, 7}, {175, 6, 0, 8}, {177, 6, 0, 8}, {203, 6, 0, 9},
+		{138, 11, 1, 7}, {176, 6, 0, 8}, {184, 6, 0, 8}, {204, 6, 0, 9}, {180, 6, 0, 8}, {205, 6, 0, 9}, {206, 6, 0, 9}, {215, 6, 0, 10},
+		{137, 11, 1, 7}, {175, 0, 1, 8}, {183, 4, 0, 8}, {204, 1, 1, 9}, {184, 11, 1, 8}, {208, 6, 0, 9}, {209, 6, 0, 9}, {216, 6, 0, 10},
+		{177, 11, 1, 8}, {205, 0, 1, 9}, {209, 11, 1, 9}, {217, 6, 0, 10}, {206, 11, 1, 9}, {218, 6, 0, 10}, {219, 6, 0, 10}, {221, 6, 0, 11},
+		{136, 5, 0, 7}, {174, 5, 0, 8}, {175, 5, 0, 8}, {203, 5, 0, 9}, {176, 5, 0, 8}, {204, 5, 0, 9}, {205, 5, 0, 9}, {215, 5, 0, 10},
+		{175, 11, 1, 8}, {204, 0, 1, 9}, {208, 5, 0, 9}, {216, 5, 0, 10}, {205, 11, 1, 9}, {217, 5, 0, 10}, {218, 5, 0, 10}, {221, 5, 0, 11},
+		{174, 4, 0, 8}, {203, 4, 0, 9}, {204, 4, 0, 9}, {215, 4, 0, 10}, {204, 11, 1, 9}, {216, 4, 0, 10}, {217, 4, 0, 10}, {221, 4, 0, 11},
+		{203, 3, 0, 9}, {215, 3, 0, 10}, {216, 3, 0, 10}, {221, 3, 0, 11}, {215, 2, 0, 10}, {221, 2, 0, 11}, {221, 1, 0, 11}, {222, 0, 0, 12},
+	},
+	{
+		0xcULL, 0xb1ULL, 0xa2ULL, 0x93ULL, 0x84ULL, 0x75ULL, 0x66ULL, 0xa11ULL,
+		0x912ULL, 0x813ULL, 0x714ULL, 0x615ULL, 0x822ULL, 0x723ULL, 0x624ULL, 0x552ULL,
+		0x633ULL, 0x534ULL, 0x444ULL, 0x9111ULL, 0x8112ULL, 0x8121ULL, 0x7113ULL, 0x6114ULL,
+		0x5511ULL, 0x7131ULL, 0x6141ULL, 0x5151ULL, 0x7212ULL, 0x7122ULL, 0x6213ULL, 0x6123ULL,
+		0x5214ULL, 0x6132ULL, 0x5124ULL, 0x5142ULL, 0x5313ULL, 0x5133ULL, 0x4413ULL, 0x4341ULL,
+		0x6222ULL, 0x5223ULL, 0x5232ULL, 0x4422ULL, 0x4242ULL, 0x4323ULL, 0x4233ULL, 0x3333ULL,
+		0x81111ULL, 0x71112ULL, 0x71121ULL, 0x61113ULL, 0x51114ULL, 0x61131ULL, 0x51141ULL, 0x62112ULL,
+		0x61122ULL, 0x61212ULL, 0x52113ULL, 0x61221ULL, 0x51123ULL, 0x44112ULL, 0x51132ULL, 0x42411ULL,
+		0x51213ULL, 0x44121ULL, 0x43113ULL, 0x51312ULL, 0x41133ULL, 0x51231ULL, 0x41412ULL, 0x41313ULL,
+		0x41331ULL, 0x52122ULL, 0x51222ULL, 0x42123ULL, 0x42213ULL, 0x41223ULL, 0x42132ULL, 0x41232ULL,
+		0x41322ULL, 0x33312ULL, 0x33132ULL, 0x42222ULL, 0x33222ULL, 0x32322ULL, 0x711111ULL, 0x611112ULL,
+		0x611121ULL, 0x511113ULL, 0x611211ULL, 0x441111ULL, 0x511131ULL, 0x511311ULL, 0x414111ULL, 0x411411ULL,
+		0x521112ULL, 0x511122ULL, 0x512112ULL, 0x421113ULL, 0x511212ULL, 0x411123ULL, 0x511221ULL, 0x411132ULL,
+		0x512121ULL, 0x333111ULL, 0x412113ULL, 0x411213ULL, 0x413112ULL, 0x411231ULL, 0x411312ULL, 0x411321ULL,
+		0x412131ULL, 0x331131ULL, 0x313131ULL, 0x421122ULL, 0x411222ULL, 0x421212ULL, 0x332112ULL, 0x412122ULL,
+		0x331122ULL, 0x412212ULL, 0x323112ULL, 0x412221ULL, 0x322311ULL, 0x331212ULL, 0x331221ULL, 0x323121ULL,
+		0x321312ULL, 0x321231ULL, 0x312312ULL, 0x313122ULL, 0x322122ULL, 0x321222ULL, 0x312222ULL, 0x222222ULL,
+		0x6111111ULL, 0x5111112ULL, 0x4111113ULL, 0x5111121ULL, 0x5111211ULL, 0x4111131ULL, 0x4111311ULL, 0x4211112ULL,
+		0x4111122ULL, 0x3311112ULL, 0x4121112ULL, 0x3231111ULL, 0x4111212ULL, 0x4112112ULL, 0x4111221ULL, 0x4112211ULL,
+		0x3311121ULL, 0x3311211ULL, 0x4121121ULL, 0x3131112ULL, 0x4112121ULL, 0x3123111ULL, 0x3113112ULL, 0x3131121ULL,
+		0x3121311ULL, 0x3211122ULL, 0x3111222ULL, 0x3211212ULL, 0x3121122ULL, 0x3112122ULL, 0x3122112ULL, 0x3112212ULL,
+		0x3112221ULL, 0x3121212ULL, 0x3121221ULL, 0x2222211ULL, 0x2222121ULL, 0x2221221ULL, 0x51111111ULL, 0x41111112ULL,
+		0x33111111ULL, 0x41111121ULL, 0x41111211ULL, 0x41112111ULL, 0x31311111ULL, 0x31131111ULL, 0x31113111ULL, 0x32111112ULL,
+		0x31111122ULL, 0x31211112ULL, 0x31111212ULL, 0x31121112ULL, 0x31111221ULL, 0x31112112ULL, 0x31112211ULL, 0x31211121ULL,
+		0x31112121ULL, 0x31121121ULL, 0x31121211ULL, 0x22221111ULL, 0x22211121ULL, 0x22122111ULL, 0x22211211ULL, 0x22112211ULL,
+		0x22121121ULL, 0x22112121ULL, 0x21212121ULL, 0x411111111ULL, 0x311111112ULL, 0x311111121ULL, 0x311111211ULL, 0x311112111ULL,
+		0x222111111ULL, 0x221111121ULL, 0x221111211ULL, 0x221112111ULL, 0x212121111ULL, 0x212111211ULL, 0x211211211ULL, 0x3111111111ULL,
+		0x2211111111ULL, 0x2121111111ULL, 0x2112111111ULL, 0x2111211111ULL, 0x2111121111ULL, 0x21111111111ULL, 0x111111111111ULL,
+	},
+	{
+		0x000000, 0x100000, 0x010000, 0x001000, 0x000100, 0x000010, 0x000001, 0x210000, 0x111000, 0x101100, 0x100110, 0x100011, 0x020100, 0x011010, 0x010101, 0x010020,
+		0x002001, 0x001110, 0x000300, 0x321000, 0x221100, 0x212100, 0x211110, 0x210111, 0x210021, 0x201210, 0x200121, 0x200022, 0x122010, 0x121110, 0x112101, 0x112011,
+		0x111120, 0x111111, 0x111111, 0x110121, 0x102210, 0x102111, 0x101310, 0x101220, 0x030201, 0x021120, 0x021030, 0x020301, 0x020202, 0x012120, 0x012111, 0x004002,
+		0x432100, 0x332110, 0x322210, 0x322111, 0x321121, 0x311221, 0x310132, 0x232201, 0x231211, 0x223111, 0x222220, 0x222121, 0x222121, 0x221311, 0x221131, 0x220222,
+		0x213211, 0x212320, 0x212320, 0x212221, 0x212221, 0x212122, 0x211231, 0x202420, 0x202321, 0x132130, 0x131221, 0x123121, 0x122311, 0x122230, 0x122212, 0x122131,
+		0x121321, 0x114112, 0x113221, 0x040402, 0x032221, 0x032140, 0x543210, 0x443211, 0x433221, 0x433221, 0x432321, 0x432321, 0x422232, 0x421242, 0x421242, 0x420243,
+		0x343230, 0x342231, 0x333321, 0x333321, 0x333231, 0x333231, 0x332232, 0x332232, 0x324222, 0x324222, 0x323430, 0x323421, 0x322431, 0x322332, 0x322332, 0x322242,
+		0x313431, 0x313431, 0x303630, 0x242412, 0x241422, 0x234222, 0x234222, 0x233331, 0x233331, 0x233241, 0x233241, 0x232341, 0x232341, 0x225222, 0x224322, 0x224322,
+		0x224232, 0x224232, 0x224223, 0x223431, 0x143250, 0x143241, 0x142422, 0x060603, 0x654321, 0x554331, 0x544431, 0x544332, 0x543342, 0x533442, 0x532353, 0x454422,
+		0x453432, 0x445332, 0x444441, 0x444342, 0x444342, 0x443532, 0x443352, 0x442443, 0x435432, 0x434541, 0x434541, 0x434442, 0x434442, 0x434343, 0x433452, 0x424641,
+		0x424542, 0x354351, 0x353442, 0x345342, 0x344532, 0x344451, 0x344433, 0x344352, 0x343542, 0x336333, 0x335442, 0x262623, 0x254442, 0x254361, 0x765442, 0x665542,
+		0x656542, 0x655552, 0x654553, 0x654463, 0x645652, 0x644563, 0x644464, 0x566452, 0x565552, 0x556543, 0x556453, 0x555562, 0x555553, 0x555553, 0x554563, 0x546652,
+		0x546553, 0x545752, 0x545662, 0x474643, 0x465562, 0x465472, 0x464743, 0x464644, 0x456562, 0x456553, 0x448444, 0x876663, 0x777663, 0x767763, 0x766773, 0x766674,
+		0x686763, 0x677673, 0x676764, 0x676683, 0x668664, 0x667773, 0x666963, 0x988884, 0x898884, 0x889884, 0x888984, 0x888894, 0x888885, 0xaaaaa5, 0xccccc6,
+	},
+	{
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 34, 33, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 60, 59, 255, 255, 255,
+		255, 66, 65, 68, 67, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 89, 88, 91, 90, 255, 94, 93, 255,
+		255, 255, 99, 98, 101, 100, 103, 102, 105, 104, 255, 255, 255, 110, 109, 255,
+		113, 112, 255, 255, 255, 118, 117, 120, 119, 122, 121, 124, 123, 255, 127, 126,
+		129, 128, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 148, 147, 255, 255, 255, 255, 154, 153, 156, 155, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 189, 188, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+	},
+	{
+		221, 215, 216, 217, 218, 219, 220, 203, 204, 205, 206, 207, 208, 209, 210, 211,
+		212, 213, 214, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186,
+		187, 188, 189, 190, 191, 192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202,
+		136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149, 150, 151,
+		152, 153, 154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167,
+		168, 169, 170, 171, 172, 173, 86, 87, 89, 88, 91, 90, 92, 94, 93, 95,
+		96, 97, 99, 98, 101, 100, 103, 102, 105, 104, 106, 107, 108, 110, 109, 111,
+		113, 112, 114, 115, 116, 118, 117, 120, 119, 122, 121, 124, 123, 125, 127, 126,
+		129, 128, 130, 131, 132, 133, 134, 135, 48, 49, 50, 51, 52, 53, 54, 55,
+		56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71,
+		72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 19, 20,
+		21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,
+		37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 7, 8, 9, 10, 11,
+		12, 13, 14, 15, 16, 17, 18, 1, 2, 3, 4, 5, 6, 0, 255,
+	},
+	{
+		0, 25, 48, 83, 135, 255, 255, 255, 255, 255, 255, 255, 50, 255, 64, 211,
+		255, 255, 255, 115, 255, 255, 56, 255, 65, 78, 255, 255, 150, 173, 255, 255,
+		93, 205, 255, 80, 198, 255, 182, 255, 88, 24, 42, 104, 174, 210, 255, 255,
+		130, 255, 255, 255, 255, 47, 255, 255, 177, 11, 172, 160, 192, 255, 188, 255,
+		255, 29, 62, 85, 46, 194, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 12, 217, 255, 255, 216, 255, 255, 255, 255, 114, 255,
+		84, 72, 255, 255, 255, 255, 255, 255, 255, 255, 137, 255, 145, 255, 4, 95,
+		43, 96, 27, 169, 255, 183, 146, 255, 19, 170, 255, 255, 255, 255, 255, 255,
+		255, 15, 109, 162, 22, 178, 37, 196, 200, 255, 255, 33, 255, 255, 255, 255,
+		49, 39, 57, 255, 9, 81, 255, 255, 255, 255, 255, 255, 215, 58, 14, 82,
+		255, 255, 255, 220, 134, 204, 255, 74, 195, 212, 255, 255, 142, 255, 255, 255,
+		255, 255, 213, 139, 255, 255, 255, 255, 255, 100, 255, 128, 255, 97, 186, 155,
+		255, 255, 28, 255, 255, 255, 255, 255, 187, 123, 255, 255, 255, 255, 45, 255,
+		255, 23, 41, 54, 255, 255, 255, 255, 255, 51, 214, 255, 107, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 67, 255, 255, 255, 255, 116, 193, 203, 255, 3,
+		199, 255, 255, 2, 40, 255, 255, 255, 206, 255, 255, 255, 255, 163, 255, 255,
+		255, 255, 255, 255, 255, 255, 102, 133, 141, 165, 255, 31, 255, 255, 255, 255,
+		255, 151, 255, 255, 255, 32, 190, 255, 8, 143, 16, 222, 255, 255, 255, 255,
+		255, 255, 255, 75, 255, 17, 164, 255, 255, 255, 255, 255, 255, 53, 77, 219,
+		255, 255, 255, 255, 255, 255, 1, 63, 209, 38, 255, 255, 6, 44, 255, 55,
+		221, 255, 255, 255, 147, 255, 255, 255, 255, 92, 121, 76, 18, 255, 86, 255,
+		255, 255, 255, 255, 87, 255, 255, 255, 181, 255, 255, 255, 255, 255, 255, 7,
+		176, 98, 35, 126, 175, 255, 185, 106, 255, 255, 59, 255, 10, 131, 149, 159,
+		191, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 140, 161, 157, 255, 255,
+		255, 132, 61, 255, 71, 255, 255, 158, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 26, 255, 255, 90, 13, 255, 255, 255, 21, 255, 255,
+		112, 20, 52, 30, 69, 73, 108, 180, 255, 36, 255, 255, 255, 70, 255, 255,
+		255, 255, 255, 255, 255, 255, 5, 207, 255, 255, 255, 255, 255, 255, 255, 255,
+		255, 255, 255, 255, 255, 167, 218, 255, 255, 136, 111, 171, 255, 179, 197, 255,
+		255, 255, 208, 125, 255, 255, 138, 117, 152, 202, 255, 255, 255, 255, 255, 255,
+		144, 255, 119, 153, 166, 184, 255, 201, 255, 255, 255, 79, 168, 255, 255, 255,
+	},
+};
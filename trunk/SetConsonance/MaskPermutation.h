@@ -0,0 +1,257 @@
+// Copyleft 2026 Chris Korda
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation; either version 2 of the License, or any later version.
+/*
+		chris korda
+
+		revision history:
+		rev		date	comments
+		00		17oct26	initial version
+		01		17oct26	add fixed place count permutations
+
+		iterate permutations of a spaced interval set as pitch class masks
+
+*/
+
+#pragma once
+
+#include "IntervalSet.h"
+#include "PitchClassSet.h"
+
+// Steps through the same permutations as GetPermutations with a spacing,
+// in the same order, but yields each one as a 12-bit mask instead of an
+// interval set. The digits are advanced like an odometer, with the first
+// place changing fastest, as in CIntervalSet::Unpack. Each place has a
+// table of single-bit masks, one per digit, and the places' ranges don't
+// overlap, so a permutation's mask is the OR of its places' masks. The OR
+// of all places above the first is cached per place and only updated on
+// carry, so a typical step is an increment and one OR, with no division
+// and no allocation.
+
+class CMaskPermutation {
+public:
+// Construction
+	CMaskPermutation();
+	CMaskPermutation(const CIntervalSet& set, const CIntervalSet& spacing);
+	void	Init(const CIntervalSet& set, const CIntervalSet& spacing);
+
+// Attributes
+	int		GetPlaceCount() const;
+	int		GetCount() const;
+	bool	IsDone() const;
+	WORD	GetMask() const;
+	int		GetDigit(int iPlace) const;
+
+// Operations
+	void	Reset();
+	void	Next();
+
+protected:
+// Data members
+	int		m_nPlaces;		// number of places
+	bool	m_bDone;		// true if iteration is complete
+	WORD	m_nMask;		// mask of current permutation
+	BYTE	m_arrRange[MAX_PLACES];	// number of digits in each place
+	BYTE	m_arrDigit[MAX_PLACES];	// current digit in each place
+	WORD	m_arrAbove[MAX_PLACES];	// OR of current masks of places above each place
+	WORD	m_arrPlaceMask[MAX_PLACES][MAX_PITCH_COUNT];	// mask for each digit of each place
+
+// Helpers
+	void	UpdateAbove(int iPlace);
+};
+
+inline CMaskPermutation::CMaskPermutation()
+{
+	m_nPlaces = 0;
+	m_bDone = true;
+	m_nMask = 0;
+}
+
+inline CMaskPermutation::CMaskPermutation(const CIntervalSet& set, const CIntervalSet& spacing)
+{
+	Init(set, spacing);
+}
+
+inline void CMaskPermutation::Init(const CIntervalSet& set, const CIntervalSet& spacing)
+{
+	// spacing must have at least as many places as set
+	m_nPlaces = set.GetSize();
+	int	nOffset = 0;
+	for (int iPlace = 0; iPlace < m_nPlaces; iPlace++) {
+		int	nRange = set.GetRange(iPlace);
+		ASSERT(nRange > 0 && nOffset + nRange <= MAX_PITCH_COUNT);
+		m_arrRange[iPlace] = static_cast<BYTE>(nRange);
+		for (int iDigit = 0; iDigit < nRange; iDigit++)
+			m_arrPlaceMask[iPlace][iDigit] = static_cast<WORD>(1 << (nOffset + iDigit));
+		nOffset += nRange + spacing[iPlace];
+	}
+	Reset();
+}
+
+inline int CMaskPermutation::GetPlaceCount() const
+{
+	return m_nPlaces;
+}
+
+inline int CMaskPermutation::GetCount() const
+{
+	// same as CIntervalSet::GetPermutationCount
+	int	nPerms = 1;
+	for (int iPlace = 0; iPlace < m_nPlaces; iPlace++)
+		nPerms *= m_arrRange[iPlace];
+	return nPerms;
+}
+
+inline bool CMaskPermutation::IsDone() const
+{
+	return m_bDone;
+}
+
+inline WORD CMaskPermutation::GetMask() const
+{
+	ASSERT(!m_bDone);
+	return m_nMask;
+}
+
+inline int CMaskPermutation::GetDigit(int iPlace) const
+{
+	ASSERT(iPlace >= 0 && iPlace < m_nPlaces);
+	return m_arrDigit[iPlace];
+}
+
+inline void CMaskPermutation::UpdateAbove(int iPlace)
+{
+	// recompute cached ORs for given place and the places below it
+	WORD	nAbove = iPlace + 1 < m_nPlaces ? 
+		m_arrAbove[iPlace + 1] | m_arrPlaceMask[iPlace + 1][m_arrDigit[iPlace + 1]] : 0;
+	for (; iPlace >= 0; iPlace--) {
+		m_arrAbove[iPlace] = nAbove;
+		nAbove |= m_arrPlaceMask[iPlace][m_arrDigit[iPlace]];
+	}
+}
+
+inline void CMaskPermutation::Reset()
+{
+	m_bDone = m_nPlaces <= 0;
+	m_nMask = 0;
+	for (int iPlace = 0; iPlace < m_nPlaces; iPlace++)
+		m_arrDigit[iPlace] = 0;
+	if (!m_bDone) {
+		UpdateAbove(m_nPlaces - 1);
+		m_nMask = m_arrAbove[0] | m_arrPlaceMask[0][0];
+	}
+}
+
+inline void CMaskPermutation::Next()
+{
+	ASSERT(!m_bDone);
+	int	iDigit = m_arrDigit[0] + 1;
+	if (iDigit < m_arrRange[0]) {	// if no carry; usual case
+		m_arrDigit[0] = static_cast<BYTE>(iDigit);
+		m_nMask = m_arrAbove[0] | m_arrPlaceMask[0][iDigit];
+		return;
+	}
+	m_arrDigit[0] = 0;
+	int	iPlace = 1;
+	for (; iPlace < m_nPlaces; iPlace++) {	// propagate carry
+		iDigit = m_arrDigit[iPlace] + 1;
+		if (iDigit < m_arrRange[iPlace]) {
+			m_arrDigit[iPlace] = static_cast<BYTE>(iDigit);
+			break;
+		}
+		m_arrDigit[iPlace] = 0;
+	}
+	if (iPlace >= m_nPlaces) {	// if carry out of last place
+		m_bDone = true;
+		return;
+	}
+	UpdateAbove(iPlace - 1);
+	m_nMask = m_arrAbove[0] | m_arrPlaceMask[0][0];
+}
+
+// CFixedMaskPermutation yields the same masks as CMaskPermutation, in the
+// same order, but its place count is a template argument, and instead of
+// stepping an odometer, it runs one nested loop per place, with the first
+// place innermost. The nesting is generated by CMaskPermutationLoop, so it's
+// fully unrolled for each place count, and each level's partial mask stays
+// in a register. The callback is called with each mask, and iteration stops
+// early if it returns false.
+
+template<int PLACE>
+struct CMaskPermutationLoop {
+	template<class FUNC>
+	static bool Run(const BYTE *pRange, const WORD (*pPlaceMask)[MAX_PITCH_COUNT], WORD nAbove, FUNC& func)
+	{
+		// loop over digits of place PLACE - 1, and recurse for places below it
+		const WORD	*pMask = pPlaceMask[PLACE - 1];
+		int	nRange = pRange[PLACE - 1];
+		for (int iDigit = 0; iDigit < nRange; iDigit++) {
+			if (!CMaskPermutationLoop<PLACE - 1>::Run(pRange, pPlaceMask, nAbove | pMask[iDigit], func))
+				return false;
+		}
+		return true;
+	}
+};
+
+template<>
+struct CMaskPermutationLoop<0> {
+	template<class FUNC>
+	static bool Run(const BYTE * /*pRange*/, const WORD (* /*pPlaceMask*/)[MAX_PITCH_COUNT], WORD nMask, FUNC& func)
+	{
+		// all places have been chosen, so mask is complete
+		return func(nMask);
+	}
+};
+
+template<int PLACES>
+class CFixedMaskPermutation {
+public:
+// Construction
+	CFixedMaskPermutation(const CIntervalSet& set, const CIntervalSet& spacing);
+
+// Attributes
+	int		GetCount() const;
+
+// Operations
+	template<class FUNC>
+	bool	ForEach(FUNC& func) const;
+
+protected:
+// Data members
+	BYTE	m_arrRange[PLACES];	// number of digits in each place
+	WORD	m_arrPlaceMask[PLACES][MAX_PITCH_COUNT];	// mask for each digit of each place
+};
+
+template<int PLACES>
+inline CFixedMaskPermutation<PLACES>::CFixedMaskPermutation(const CIntervalSet& set, const CIntervalSet& spacing)
+{
+	// same as CMaskPermutation::Init
+	ASSERT(set.GetSize() == PLACES);
+	int	nOffset = 0;
+	for (int iPlace = 0; iPlace < PLACES; iPlace++) {
+		int	nRange = set.GetRange(iPlace);
+		ASSERT(nRange > 0 && nOffset + nRange <= MAX_PITCH_COUNT);
+		m_arrRange[iPlace] = static_cast<BYTE>(nRange);
+		for (int iDigit = 0; iDigit < nRange; iDigit++)
+			m_arrPlaceMask[iPlace][iDigit] = static_cast<WORD>(1 << (nOffset + iDigit));
+		nOffset += nRange + spacing[iPlace];
+	}
+}
+
+template<int PLACES>
+inline int CFixedMaskPermutation<PLACES>::GetCount() const
+{
+	int	nPerms = 1;
+	for (int iPlace = 0; iPlace < PLACES; iPlace++)
+		nPerms *= m_arrRange[iPlace];
+	return nPerms;
+}
+
+template<int PLACES>
+template<class FUNC>
+inline bool CFixedMaskPermutation<PLACES>::ForEach(FUNC& func) const
+{
+	// returns false if callback stopped iteration
+	return CMaskPermutationLoop<PLACES>::Run(m_arrRange, m_arrPlaceMask, 0, func);
+}
@@ -0,0 +1,160 @@
+// Copyleft 2026 Chris Korda
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation; either version 2 of the License, or any later version.
+/*
+		chris korda
+
+		revision history:
+		rev		date	comments
+		00		17oct26	initial version
+
+		fixed-size hash table that maps names to integers
+
+*/
+
+#ifndef CNAME_INDEX
+#define	CNAME_INDEX
+
+// Names aren't copied, so their storage must outlive the index. A name
+// can be a substring, in which case its length is passed explicitly.
+
+template<int SLOTS>	// number of slots; must be a power of two
+class CNameIndex {
+public:
+// Construction
+	CNameIndex(bool bNoCase = false);
+
+// Attributes
+	int		GetCount() const;
+	bool	IsEmpty() const;
+
+// Operations
+	bool	Add(LPCTSTR pszName, int nLen, int nValue);
+	bool	Add(LPCTSTR pszName, int nValue);
+	int		Find(LPCTSTR pszName, int nLen) const;
+	int		Find(LPCTSTR pszName) const;
+	void	RemoveAll();
+
+protected:
+// Types
+	struct ENTRY {
+		LPCTSTR	pszName;	// pointer to name, or NULL if slot is empty
+		int		nLen;		// length of name in characters
+		int		nValue;		// value associated with name
+	};
+
+// Data members
+	ENTRY	m_arrEntry[SLOTS];	// array of slots
+	int		m_nCount;		// number of occupied slots
+	bool	m_bNoCase;		// true if comparisons are case-insensitive
+
+// Helpers
+	UINT	Hash(LPCTSTR pszName, int nLen) const;
+	bool	IsMatch(const ENTRY& entry, LPCTSTR pszName, int nLen) const;
+	int		FindSlot(LPCTSTR pszName, int nLen) const;
+};
+
+template<int SLOTS>
+inline CNameIndex<SLOTS>::CNameIndex(bool bNoCase)
+{
+	m_bNoCase = bNoCase;
+	RemoveAll();
+}
+
+template<int SLOTS>
+inline int CNameIndex<SLOTS>::GetCount() const
+{
+	return m_nCount;
+}
+
+template<int SLOTS>
+inline bool CNameIndex<SLOTS>::IsEmpty() const
+{
+	return m_nCount <= 0;
+}
+
+template<int SLOTS>
+inline void CNameIndex<SLOTS>::RemoveAll()
+{
+	for (int iSlot = 0; iSlot < SLOTS; iSlot++)
+		m_arrEntry[iSlot].pszName = NULL;
+	m_nCount = 0;
+}
+
+template<int SLOTS>
+inline UINT CNameIndex<SLOTS>::Hash(LPCTSTR pszName, int nLen) const
+{
+	UINT	nHash = 2166136261u;	// FNV-1a
+	for (int iChar = 0; iChar < nLen; iChar++) {
+		TCHAR	c = pszName[iChar];
+		if (m_bNoCase)
+			c = static_cast<TCHAR>(_totlower(c));
+		nHash ^= static_cast<UINT>(c);
+		nHash *= 16777619u;
+	}
+	return nHash;
+}
+
+template<int SLOTS>
+inline bool CNameIndex<SLOTS>::IsMatch(const ENTRY& entry, LPCTSTR pszName, int nLen) const
+{
+	if (entry.nLen != nLen)
+		return false;
+	if (m_bNoCase)
+		return !_tcsnicmp(entry.pszName, pszName, nLen);
+	return !_tcsncmp(entry.pszName, pszName, nLen);
+}
+
+template<int SLOTS>
+inline int CNameIndex<SLOTS>::FindSlot(LPCTSTR pszName, int nLen) const
+{
+	// linear probing; returns matching slot, or empty slot if not found
+	int	iSlot = Hash(pszName, nLen) & (SLOTS - 1);
+	while (m_arrEntry[iSlot].pszName != NULL) {
+		if (IsMatch(m_arrEntry[iSlot], pszName, nLen))
+			break;
+		iSlot = (iSlot + 1) & (SLOTS - 1);
+	}
+	return iSlot;
+}
+
+template<int SLOTS>
+inline bool CNameIndex<SLOTS>::Add(LPCTSTR pszName, int nLen, int nValue)
+{
+	// returns false if name is already present or table is too full
+	if (m_nCount >= SLOTS - 1)	// keep at least one slot empty to terminate probing
+		return false;
+	ENTRY&	entry = m_arrEntry[FindSlot(pszName, nLen)];
+	if (entry.pszName != NULL)	// if name already present
+		return false;
+	entry.pszName = pszName;
+	entry.nLen = nLen;
+	entry.nValue = nValue;
+	m_nCount++;
+	return true;
+}
+
+template<int SLOTS>
+inline bool CNameIndex<SLOTS>::Add(LPCTSTR pszName, int nValue)
+{
+	return Add(pszName, static_cast<int>(_tcslen(pszName)), nValue);
+}
+
+template<int SLOTS>
+inline int CNameIndex<SLOTS>::Find(LPCTSTR pszName, int nLen) const
+{
+	// returns value associated with name, or -1 if name not found
+	const ENTRY&	entry = m_arrEntry[FindSlot(pszName, nLen)];
+	if (entry.pszName == NULL)
+		return -1;
+	return entry.nValue;
+}
+
+template<int SLOTS>
+inline int CNameIndex<SLOTS>::Find(LPCTSTR pszName) const
+{
+	return Find(pszName, static_cast<int>(_tcslen(pszName)));
+}
+
+#endif
@@ -0,0 +1,105 @@
+// Copyleft 2026 Chris Korda
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation; either version 2 of the License, or any later version.
+/*
+		chris korda
+
+		revision history:
+		rev		date	comments
+		00		17oct26	initial version
+		01		17oct26	use atomic busy flag; shut down pool explicitly
+
+		split a loop across threads
+
+*/
+
+#include "stdafx.h"
+#include "ParallelFor.h"
+
+CThreadPool *CThreadPool::m_pThePool = new CThreadPool;
+
+CThreadPool::CThreadPool() : m_bBusy(false)
+{
+	m_pFunc = NULL;
+	m_pParam = NULL;
+	m_nItems = 0;
+	m_nBlocks = 0;
+	m_iNextBlock = 0;
+	m_nBlocksLeft = 0;
+	m_bQuit = false;
+}
+
+CThreadPool::~CThreadPool()
+{
+	Shutdown();
+}
+
+void CThreadPool::Shutdown()
+{
+	// stops and joins workers; the pool restarts them if it's used again
+	{
+		std::unique_lock<std::mutex>	lock(m_mtxState);
+		m_bQuit = true;
+	}
+	m_cvWork.notify_all();
+	int	nThreads = static_cast<int>(m_arrThread.size());
+	for (int iThread = 0; iThread < nThreads; iThread++)
+		m_arrThread[iThread].join();
+	m_arrThread.clear();
+	m_bQuit = false;
+}
+
+bool CThreadPool::Run(int nItems, int nBlocks, BLOCK_FUNC pFunc, void *pParam)
+{
+	// returns false if another loop is running, including one that called
+	// us from within a block, on this thread or any other
+	if (m_bBusy.exchange(true))	// if pool is busy
+		return false;
+	std::unique_lock<std::mutex>	lock(m_mtxState);
+	while (static_cast<int>(m_arrThread.size()) < nBlocks - 1)	// calling thread runs blocks too
+		m_arrThread.push_back(std::thread(&CThreadPool::WorkerMain, this));
+	m_pFunc = pFunc;
+	m_pParam = pParam;
+	m_nItems = nItems;
+	m_nBlocks = nBlocks;
+	m_iNextBlock = 0;
+	m_nBlocksLeft = nBlocks;
+	m_cvWork.notify_all();
+	RunBlocks(lock);
+	while (m_nBlocksLeft > 0)	// wait for blocks claimed by workers
+		m_cvDone.wait(lock);
+	lock.unlock();
+	m_bBusy = false;
+	return true;
+}
+
+void CThreadPool::RunBlocks(std::unique_lock<std::mutex>& lock)
+{
+	// claim and run blocks until none are left; lock must be held on entry,
+	// and is held on exit, but is released while each block runs
+	while (m_iNextBlock < m_nBlocks) {
+		int	iBlock = m_iNextBlock++;
+		int	iStart = static_cast<int>(static_cast<int64_t>(m_nItems) * iBlock / m_nBlocks);
+		int	iEnd = static_cast<int>(static_cast<int64_t>(m_nItems) * (iBlock + 1) / m_nBlocks);
+		BLOCK_FUNC	pFunc = m_pFunc;
+		void	*pParam = m_pParam;
+		lock.unlock();
+		pFunc(pParam, iStart, iEnd);
+		lock.lock();
+		if (--m_nBlocksLeft == 0)	// if last block done
+			m_cvDone.notify_one();
+	}
+}
+
+void CThreadPool::WorkerMain()
+{
+	std::unique_lock<std::mutex>	lock(m_mtxState);
+	for (;;) {
+		while (!m_bQuit && m_iNextBlock >= m_nBlocks)	// while no blocks available
+			m_cvWork.wait(lock);
+		if (m_bQuit)
+			break;
+		RunBlocks(lock);
+	}
+}
@@ -0,0 +1,106 @@
+// Copyleft 2026 Chris Korda
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation; either version 2 of the License, or any later version.
+/*
+		chris korda
+
+		revision history:
+		rev		date	comments
+		00		17oct26	initial version
+		01		17oct26	use persistent thread pool
+		02		17oct26	use atomic busy flag; shut down pool explicitly
+
+		split a loop across threads
+
+*/
+
+#pragma once
+
+#include "stdint.h"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <vector>
+
+// CThreadPool runs the blocks of a loop on worker threads that persist from
+// one loop to the next, so that a loop doesn't pay for creating and joining
+// threads. Workers are started on demand, and the pool never shrinks. The
+// calling thread also runs blocks, and returns after all blocks are done.
+// Only one loop runs at a time; if the pool is busy, as when a block starts
+// a loop of its own, Run fails and the caller should run the loop serially.
+// The pool must not be used during static initialization or destruction.
+// It's never destroyed, because joining threads from a static destructor
+// can deadlock the runtime library; instead, shut it down before main
+// returns, or else its workers are simply ended with the process.
+
+class CThreadPool {
+public:
+// Types
+	typedef void (*BLOCK_FUNC)(void *pParam, int iStart, int iEnd);
+
+// Construction
+	CThreadPool();
+	~CThreadPool();
+
+// Operations
+	static	CThreadPool&	GetPool();
+	bool	Run(int nItems, int nBlocks, BLOCK_FUNC pFunc, void *pParam);
+	void	Shutdown();
+
+protected:
+// Data members
+	std::atomic<bool>	m_bBusy;	// true while a loop is running
+	std::mutex	m_mtxState;		// protects state below
+	std::condition_variable	m_cvWork;	// signaled when blocks are available or pool is quitting
+	std::condition_variable	m_cvDone;	// signaled when all blocks are done
+	std::vector<std::thread>	m_arrThread;	// worker threads
+	BLOCK_FUNC	m_pFunc;		// function that runs a block
+	void	*m_pParam;			// parameter passed to block function
+	int		m_nItems;			// number of items in loop
+	int		m_nBlocks;			// number of blocks in loop
+	int		m_iNextBlock;		// index of next block to claim
+	int		m_nBlocksLeft;		// number of blocks not yet done
+	bool	m_bQuit;			// true if workers should exit
+	static	CThreadPool	*m_pThePool;	// one and only pool, never destroyed
+
+// Helpers
+	void	WorkerMain();
+	void	RunBlocks(std::unique_lock<std::mutex>& lock);
+
+private:
+	CThreadPool(const CThreadPool&);	// not copyable
+	CThreadPool& operator=(const CThreadPool&);
+};
+
+inline CThreadPool& CThreadPool::GetPool()
+{
+	return *m_pThePool;
+}
+
+template<class FUNC>
+void ParallelForBlock(void *pParam, int iStart, int iEnd)
+{
+	(*static_cast<FUNC *>(pParam))(iStart, iEnd);
+}
+
+// Divides the range [0, nItems) into one contiguous block per thread, and
+// calls func(iStart, iEnd) for each block, using the thread pool. Blocks
+// are never smaller than nMinBlock items, so small ranges run serially.
+// If nThreads is zero, the number of hardware threads is used.
+
+template<class FUNC>
+void ParallelFor(int nItems, int nMinBlock, FUNC func, int nThreads = 0)
+{
+	if (nThreads <= 0)
+		nThreads = static_cast<int>(std::thread::hardware_concurrency());
+	if (nMinBlock < 1)
+		nMinBlock = 1;
+	if (nThreads > nItems / nMinBlock)
+		nThreads = nItems / nMinBlock;
+	if (nThreads <= 1 || !CThreadPool::GetPool().Run(nItems, nThreads, ParallelForBlock<FUNC>, &func)) {
+		if (nItems > 0)	// not worth threading, or pool is busy
+			func(0, nItems);
+	}
+}
@@ -0,0 +1,195 @@
+// Copyleft 2026 Chris Korda
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation; either version 2 of the License, or any later version.
+/*
+		chris korda
+
+		revision history:
+		rev		date	comments
+		00		17oct26	initial version
+		01		17oct26	use interval vector kernel
+
+		pitch class set stored as a 12-bit mask
+
+*/
+
+#pragma once
+
+#include "PitchClassSet.h"
+
+// Bit N is set if the set contains pitch class N. The class is trivially
+// copyable and the same size as a WORD, so arrays of it can be copied with
+// memcpy, and a chord sequence takes two bytes per chord. Queries that
+// depend on set class go through CPitchClassSet's mask classification table.
+
+class CPitchClassMask {
+public:
+// Types
+	typedef CPitchClassSet::SET_ID SET_ID;
+	typedef CPitchClassSet::INTERVAL_VECTOR INTERVAL_VECTOR;
+
+// Construction
+	CPitchClassMask();
+	explicit CPitchClassMask(WORD nMask);
+	explicit CPitchClassMask(const CPitchClassSet& set);
+
+// Attributes
+	WORD	GetMask() const;
+	void	SetMask(WORD nMask);
+	int		GetSize() const;
+	bool	IsEmpty() const;
+	bool	Contains(int nPitch) const;
+	void	GetPitchClassSet(CPitchClassSet& set) const;
+	void	SetPitchClassSet(const CPitchClassSet& set);
+	bool	operator==(const CPitchClassMask& mask) const;
+	bool	operator!=(const CPitchClassMask& mask) const;
+
+// Operations
+	CPitchClassMask	Transpose(int nTranspose) const;
+	CPitchClassMask	Invert() const;
+	const CPitchClassSet::MASK_CLASS&	GetClass() const;
+	int		FindForte() const;
+	LPCTSTR	GetForte() const;
+	SET_ID	GetPrimeId() const;
+	CPitchClassMask	GetPrimeForm() const;
+	bool	IsEquivalent(const CPitchClassMask& mask) const;
+	void	GetIntervalVector(INTERVAL_VECTOR vec) const;
+	int		GetIntervalVector() const;
+
+protected:
+// Data members
+	WORD	m_nMask;	// bit for each pitch class
+};
+
+static_assert(sizeof(CPitchClassMask) == sizeof(WORD), "pitch class mask must be the size of a WORD");
+
+inline CPitchClassMask::CPitchClassMask()
+{
+	m_nMask = 0;
+}
+
+inline CPitchClassMask::CPitchClassMask(WORD nMask)
+{
+	ASSERT(nMask < CPitchClassSet::MASK_COUNT);
+	m_nMask = nMask;
+}
+
+inline CPitchClassMask::CPitchClassMask(const CPitchClassSet& set)
+{
+	SetPitchClassSet(set);
+}
+
+inline WORD CPitchClassMask::GetMask() const
+{
+	return m_nMask;
+}
+
+inline void CPitchClassMask::SetMask(WORD nMask)
+{
+	ASSERT(nMask < CPitchClassSet::MASK_COUNT);
+	m_nMask = nMask;
+}
+
+inline int CPitchClassMask::GetSize() const
+{
+	return GetClass().nSize;
+}
+
+inline bool CPitchClassMask::IsEmpty() const
+{
+	return !m_nMask;
+}
+
+inline bool CPitchClassMask::Contains(int nPitch) const
+{
+	ASSERT(nPitch >= 0 && nPitch < CPitchClassSet::OCTAVE);
+	return (m_nMask & (1 << nPitch)) != 0;
+}
+
+inline void CPitchClassMask::GetPitchClassSet(CPitchClassSet& set) const
+{
+	// pitches are in ascending order
+	set.SetSize(0);
+	for (int nPitch = 0; nPitch < CPitchClassSet::OCTAVE; nPitch++) {
+		if (m_nMask & (1 << nPitch))
+			set.Add(nPitch);
+	}
+}
+
+inline void CPitchClassMask::SetPitchClassSet(const CPitchClassSet& set)
+{
+	// pitches must be normalized, but needn't be sorted or unique
+	m_nMask = set.GetMask();
+}
+
+inline bool CPitchClassMask::operator==(const CPitchClassMask& mask) const
+{
+	return m_nMask == mask.m_nMask;
+}
+
+inline bool CPitchClassMask::operator!=(const CPitchClassMask& mask) const
+{
+	return m_nMask != mask.m_nMask;
+}
+
+inline CPitchClassMask CPitchClassMask::Transpose(int nTranspose) const
+{
+	// transposition is a 12-bit rotation; any offset is accepted
+	nTranspose %= CPitchClassSet::OCTAVE;
+	if (nTranspose < 0)
+		nTranspose += CPitchClassSet::OCTAVE;
+	return CPitchClassMask(CPitchClassSet::RotateMask(m_nMask, nTranspose));
+}
+
+inline CPitchClassMask CPitchClassMask::Invert() const
+{
+	// inversion around zero is a bit reversal
+	return CPitchClassMask(CPitchClassSet::InvertMask(m_nMask));
+}
+
+inline const CPitchClassSet::MASK_CLASS& CPitchClassMask::GetClass() const
+{
+	return CPitchClassSet::GetMaskClass(m_nMask);
+}
+
+inline int CPitchClassMask::FindForte() const
+{
+	// returns index of prime form, or -1 if set is empty
+	int	iPrime = GetClass().iPrime;
+	return iPrime != CPitchClassSet::NO_PRIME ? iPrime : -1;
+}
+
+inline LPCTSTR CPitchClassMask::GetForte() const
+{
+	ASSERT(!IsEmpty());
+	return CPitchClassSet::GetForte(GetClass().iPrime);
+}
+
+inline CPitchClassMask::SET_ID CPitchClassMask::GetPrimeId() const
+{
+	int	iPrime = FindForte();
+	return iPrime >= 0 ? CPitchClassSet::GetPrimeId(iPrime) : 0;
+}
+
+inline CPitchClassMask CPitchClassMask::GetPrimeForm() const
+{
+	int	iPrime = FindForte();
+	return CPitchClassMask(iPrime >= 0 ? CPitchClassSet::GetPrimeMask(iPrime) : 0);
+}
+
+inline bool CPitchClassMask::IsEquivalent(const CPitchClassMask& mask) const
+{
+	// true if sets are related by transposition and/or inversion
+	return GetClass().iPrime == mask.GetClass().iPrime;
+}
+
+inline void CPitchClassMask::GetIntervalVector(INTERVAL_VECTOR vec) const
+{
+	CPitchClassSet::GetIntervalVector(m_nMask, vec);
+}
+
+inline int CPitchClassMask::GetIntervalVector() const
+{
+	return CPitchClassSet::GetIntervalVector(m_nMask);
+}
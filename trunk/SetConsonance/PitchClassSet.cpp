@@ -16,17 +16,179 @@
 		06		19sep24	add symbol column to Forte definitions
 		07		06aug25	use square brackets instead of parentheses
 		08		15sep25	add GetMask
+		09		17oct26	add mask classification table
+		10		17oct26	add perfect hash for FindForte
+		11		17oct26	add hashed Forte name index
+		12		17oct26	add interval vector kernel and Z-relation index
+		13		17oct26	add batch classification
+		14		17oct26	add complement classification
+		15		17oct26	bake prime form masks and validate Forte table at compile time
+		16		17oct26	bake mask classification table
 
 */
 
 #include "stdafx.h"
 #include "PitchClassSet.h"
+#include "ParallelFor.h"
+
+// These macros evaluate set IDs at compile time, so that the Forte table
+// can be validated with static assertions, and prime form masks can be
+// stored in the table instead of being computed at startup. A set ID has
+// at most twelve intervals, and SET_ID_SUM(id, N) is the sum of the first
+// N intervals, which is also the pitch class of member N. Unused intervals
+// are zero, so the sums of a set's trailing intervals are all twelve. The
+// mask classification table is too costly to compute this way, so it's
+// generated offline by MakeMaskClassTable, from the prime form table.
+
+#define SET_ID_INTERVAL(id, i) static_cast<int>((static_cast<uint64_t>(id) >> ((i) * 4)) & 0xf)
+#define SET_ID_SUM1(id) SET_ID_INTERVAL(id, 0)
+#define SET_ID_SUM2(id) (SET_ID_SUM1(id) + SET_ID_INTERVAL(id, 1))
+#define SET_ID_SUM3(id) (SET_ID_SUM2(id) + SET_ID_INTERVAL(id, 2))
+#define SET_ID_SUM4(id) (SET_ID_SUM3(id) + SET_ID_INTERVAL(id, 3))
+#define SET_ID_SUM5(id) (SET_ID_SUM4(id) + SET_ID_INTERVAL(id, 4))
+#define SET_ID_SUM6(id) (SET_ID_SUM5(id) + SET_ID_INTERVAL(id, 5))
+#define SET_ID_SUM7(id) (SET_ID_SUM6(id) + SET_ID_INTERVAL(id, 6))
+#define SET_ID_SUM8(id) (SET_ID_SUM7(id) + SET_ID_INTERVAL(id, 7))
+#define SET_ID_SUM9(id) (SET_ID_SUM8(id) + SET_ID_INTERVAL(id, 8))
+#define SET_ID_SUM10(id) (SET_ID_SUM9(id) + SET_ID_INTERVAL(id, 9))
+#define SET_ID_SUM11(id) (SET_ID_SUM10(id) + SET_ID_INTERVAL(id, 10))
+#define SET_ID_SUM12(id) (SET_ID_SUM11(id) + SET_ID_INTERVAL(id, 11))
+#define SET_ID_MASK(id) static_cast<WORD>((1 | (1 << SET_ID_SUM1(id)) | (1 << SET_ID_SUM2(id)) \
+	| (1 << SET_ID_SUM3(id)) | (1 << SET_ID_SUM4(id)) | (1 << SET_ID_SUM5(id)) | (1 << SET_ID_SUM6(id)) \
+	| (1 << SET_ID_SUM7(id)) | (1 << SET_ID_SUM8(id)) | (1 << SET_ID_SUM9(id)) | (1 << SET_ID_SUM10(id)) \
+	| (1 << SET_ID_SUM11(id))) & CPitchClassSet::MASK_ALL)
+#define SET_ID_SIZE(id) ((SET_ID_INTERVAL(id, 0) != 0) + (SET_ID_INTERVAL(id, 1) != 0) + (SET_ID_INTERVAL(id, 2) != 0) \
+	+ (SET_ID_INTERVAL(id, 3) != 0) + (SET_ID_INTERVAL(id, 4) != 0) + (SET_ID_INTERVAL(id, 5) != 0) \
+	+ (SET_ID_INTERVAL(id, 6) != 0) + (SET_ID_INTERVAL(id, 7) != 0) + (SET_ID_INTERVAL(id, 8) != 0) \
+	+ (SET_ID_INTERVAL(id, 9) != 0) + (SET_ID_INTERVAL(id, 10) != 0) + (SET_ID_INTERVAL(id, 11) != 0))
+
+// each set ID's intervals must span exactly one octave, with no gaps
+#define FORTEDEF(id, name, sym) static_assert(SET_ID_SUM12(id) == CPitchClassSet::OCTAVE \
+	&& (static_cast<uint64_t>(id) >> (SET_ID_SIZE(id) * 4)) == 0, "invalid set ID for " name);
+#include "ForteDef.h"
+#undef FORTEDEF
+
+enum {	// count Forte table entries by size
+	FORTE_DEF_COUNT = 0
+	#define FORTEDEF(id, name, sym) + 1
+	#include "ForteDef.h"
+	#undef FORTEDEF
+	,
+	FORTE_DEF_SMALL = 0	// entries with less than three members
+	#define FORTEDEF(id, name, sym) + (SET_ID_SIZE(id) < 3)
+	#include "ForteDef.h"
+	#undef FORTEDEF
+	,
+	FORTE_DEF_CODED = 0	// entries with between three and nine members
+	#define FORTEDEF(id, name, sym) + (SET_ID_SIZE(id) >= 3 && SET_ID_SIZE(id) <= 9)
+	#include "ForteDef.h"
+	#undef FORTEDEF
+};
+
+static_assert(static_cast<int>(FORTE_DEF_COUNT) == static_cast<int>(CPitchClassSet::PRIME_FORMS), "Forte table has wrong number of entries");
+static_assert(static_cast<int>(FORTE_DEF_SMALL) == static_cast<int>(CPitchClassSet::FORTE_FIRST), "Forte table has wrong number of small sets");
+static_assert(static_cast<int>(FORTE_DEF_CODED) == static_cast<int>(CPitchClassSet::FORTE_CODES), "Forte table has wrong number of Forte codes");
 
 const CPitchClassSet::PRIME_FORM CPitchClassSet::m_arrPrimeForm[PRIME_FORMS] = {
-	#define FORTEDEF(id, name, sym) {id, _T(name)},
+	#define FORTEDEF(id, name, sym) {id, _T(name), SET_ID_MASK(id)},
 	#include "ForteDef.h"
+	#undef FORTEDEF
 };
 
+const CPitchClassSet::CForteNameTable CPitchClassSet::m_tblForteName;
+
+#include "ForteHash.h"	// defines FORTE_HASH_MULT and m_arrForteHash
+#include "MaskClass.h"	// defines m_tblMaskClass
+
+#define FORTE_HASH(id) static_cast<int>((static_cast<uint64_t>(id) * FORTE_HASH_MULT) >> (64 - CPitchClassSet::FORTE_HASH_BITS))
+
+static inline void CheckForteHash(CPitchClassSet::SET_ID id)
+{
+	// compile-time check: if two prime forms hash to the same slot, the
+	// compiler reports a duplicate case value; rerun MakeForteHash to fix
+	switch (FORTE_HASH(id)) {
+	#define FORTEDEF(id, name, sym) case FORTE_HASH(id):
+	#include "ForteDef.h"
+		break;
+	}
+}
+
+void CPitchClassSet::BuildMaskClassTable(MASK_CLASS_TABLE& tbl)
+{
+	// compute mask classification table from prime form table; used by
+	// MakeMaskClassTable to generate MaskClass.h, and to verify it
+	ZeroMemory(&tbl, sizeof(tbl));	// including padding, so tables can be compared with memcmp
+	tbl.arrMaskClass[0].iPrime = NO_PRIME;
+	memset(tbl.arrZPartner, NO_PRIME, sizeof(tbl.arrZPartner));
+	memset(tbl.arrIntVecHash, NO_PRIME, sizeof(tbl.arrIntVecHash));
+	for (int iPrime = 0; iPrime < PRIME_FORMS; iPrime++) {
+		CPitchClassSet	set(m_arrPrimeForm[iPrime].idPrime);
+		WORD	nPrimeMask = m_arrPrimeForm[iPrime].nMask;
+		ASSERT(nPrimeMask == set.GetMask());
+		set.FindPrimeForm(&tbl.arrInverseId[iPrime]);
+		int	nIntVec = GetIntervalVector(nPrimeMask);
+		tbl.arrPrimeIntVec[iPrime] = nIntVec;
+		int	iSlot = HashIntervalVector(nIntVec);
+		for (;;) {	// linear probing
+			int	iOther = tbl.arrIntVecHash[iSlot];
+			if (iOther == NO_PRIME) {	// if empty slot
+				tbl.arrIntVecHash[iSlot] = static_cast<BYTE>(iPrime);
+				break;
+			}
+			if (tbl.arrPrimeIntVec[iOther] == nIntVec) {	// if Z-related to earlier prime form
+				tbl.arrZPartner[iOther] = static_cast<BYTE>(iPrime);
+				tbl.arrZPartner[iPrime] = static_cast<BYTE>(iOther);
+				break;
+			}
+			iSlot = (iSlot + 1) & (INT_VEC_HASH_SIZE - 1);
+		}
+		int	nSize = set.GetSize();
+		// plain transpositions take precedence over inverted ones, and
+		// lower transpositions take precedence over higher ones, so that
+		// symmetrical sets are classified the same way FindHarmony does
+		for (int iPass = 0; iPass < 2; iPass++) {
+			WORD	nMask = iPass ? InvertMask(nPrimeMask) : nPrimeMask;
+			for (int nTranspose = 0; nTranspose < OCTAVE; nTranspose++) {
+				MASK_CLASS&	mc = tbl.arrMaskClass[RotateMask(nMask, nTranspose)];
+				if (!mc.nSize) {	// if mask not classified yet
+					mc.iPrime = static_cast<BYTE>(iPrime);
+					mc.nTranspose = static_cast<BYTE>(nTranspose);
+					mc.bInverted = static_cast<BYTE>(iPass);
+					mc.nSize = static_cast<BYTE>(nSize);
+				}
+			}
+		}
+	}
+	for (int iPrime = 0; iPrime < PRIME_FORMS; iPrime++)	// all masks are classified now
+		tbl.arrComplement[iPrime] = tbl.arrMaskClass[ComplementMask(m_arrPrimeForm[iPrime].nMask)].iPrime;
+}
+
+CPitchClassSet::CForteNameTable::CForteNameTable() : m_idxName(true)	// case-insensitive
+{
+	for (int iPrime = 0; iPrime < PRIME_FORMS; iPrime++) {
+		LPCTSTR	pszForte = m_arrPrimeForm[iPrime].pszForte;
+		VERIFY(m_idxName.Add(pszForte, iPrime));
+		// Forte numbers are unique within each cardinality, so the Z prefix
+		// is redundant; also index Z-related sets by their name without Z
+		LPTSTR	pszPlain = m_arrPlainName[iPrime];
+		int	nLen = 0;
+		for (LPCTSTR p = pszForte; *p; p++) {
+			if (*p != 'Z') {
+				ASSERT(nLen < FORTE_NAME_MAX - 1);
+				pszPlain[nLen++] = *p;
+			}
+		}
+		pszPlain[nLen] = 0;
+		if (_tcscmp(pszPlain, pszForte))	// if name contained Z
+			VERIFY(m_idxName.Add(pszPlain, nLen, iPrime));
+	}
+}
+
+int CPitchClassSet::HashIntervalVector(int nIntVec)
+{
+	return static_cast<int>((static_cast<UINT>(nIntVec) * 2654435761u) >> (32 - INT_VEC_HASH_BITS));
+}
+
 void CPitchClassSet::GetIntervals(CPitchClassSet& set) const
 {
 	int	nSize = GetSize();
@@ -213,26 +375,34 @@ CPitchClassSet::SET_ID CPitchClassSet::FindPrimeForm(SET_ID *pInverse)
 
 void CPitchClassSet::GetIntervalVector(INTERVAL_VECTOR vec) const
 {
-	ZeroMemory(vec, sizeof(INTERVAL_VECTOR));
-	int	nSize = GetSize();
-	for (int i = 0; i < nSize - 1; i++) {
-		for (int j = i + 1; j < nSize; j++) {
-			int	iInt = GetAt(j) - GetAt(i);
-			if (iInt > INTERVALS)
-				iInt = OCTAVE - iInt;
-			vec[iInt - 1]++;
-		}
-	}
+	GetIntervalVector(GetMask(), vec);
 }
 
 int CPitchClassSet::GetIntervalVector() const
 {
-	INTERVAL_VECTOR vec;
-	GetIntervalVector(vec);
-	int	iVec = 0;
-	for (int iInt = 0; iInt < INTERVALS; iInt++)
-		iVec |= vec[iInt] << ((INTERVALS - 1 - iInt) * 4);
-	return(iVec);
+	return GetIntervalVector(GetMask());
+}
+
+int CPitchClassSet::FindIntervalVector(int nIntVec, int *pPrime, int nMaxPrimes)
+{
+	// finds prime forms having the given packed interval vector, and returns
+	// how many were found; there are at most two, due to Z-relation
+	int	iSlot = HashIntervalVector(nIntVec);
+	const BYTE	*pHash = m_tblMaskClass.arrIntVecHash;
+	while (pHash[iSlot] != NO_PRIME) {
+		int	iPrime = pHash[iSlot];
+		if (m_tblMaskClass.arrPrimeIntVec[iPrime] == nIntVec) {
+			int	nFound = 0;
+			if (nMaxPrimes > 0)
+				pPrime[nFound++] = iPrime;
+			int	iPartner = m_tblMaskClass.arrZPartner[iPrime];
+			if (iPartner != NO_PRIME && nFound < nMaxPrimes)
+				pPrime[nFound++] = iPartner;
+			return nFound;
+		}
+		iSlot = (iSlot + 1) & (INT_VEC_HASH_SIZE - 1);
+	}
+	return 0;
 }
 
 void CPitchClassSet::MakePrimeForm()
@@ -256,20 +426,108 @@ CPitchClassSet::SET_ID CPitchClassSet::GetId() const
 
 int CPitchClassSet::FindForte(SET_ID id)
 {
-	for (int iPrime = 0; iPrime < _countof(m_arrPrimeForm); iPrime++) {
-		if (id == m_arrPrimeForm[iPrime].idPrime)
-			return iPrime;
+	int	iPrime = m_arrForteHash[FORTE_HASH(id)];
+	if (iPrime >= PRIME_FORMS || m_arrPrimeForm[iPrime].idPrime != id)	// if empty slot or wrong set
+		return -1;
+	return iPrime;
+}
+
+void CPitchClassSet::FindForte(const SET_ID *pID, int *pPrime, int nCount)
+{
+	for (int iID = 0; iID < nCount; iID++) {
+		SET_ID	id = pID[iID];
+		int	iPrime = m_arrForteHash[FORTE_HASH(id)];
+		int	iSafePrime = iPrime < PRIME_FORMS ? iPrime : 0;	// avoid branching on empty slot
+		pPrime[iID] = m_arrPrimeForm[iSafePrime].idPrime == id && iPrime < PRIME_FORMS ? iPrime : -1;
 	}
-	return -1;
 }
 
 int CPitchClassSet::FindForte(LPCTSTR pszForte)
 {
-	for (int iPrime = 0; iPrime < _countof(m_arrPrimeForm); iPrime++) {
-		if (!_tcsicmp(pszForte, m_arrPrimeForm[iPrime].pszForte))
-			return iPrime;
+	return m_tblForteName.m_idxName.Find(pszForte);
+}
+
+int CPitchClassSet::FindForte(LPCTSTR pszForte, int nLen, bool& bInverse)
+{
+	// accepts an optional A or B suffix, as in 3-11B; B denotes the
+	// inversion of the prime form, which is the A form
+	bInverse = false;
+	if (nLen > 0) {
+		TCHAR	c = static_cast<TCHAR>(_totupper(pszForte[nLen - 1]));
+		if (c == 'A' || c == 'B') {
+			bInverse = c == 'B';
+			nLen--;
+		}
+	}
+	return m_tblForteName.m_idxName.Find(pszForte, nLen);
+}
+
+CPitchClassSet::CLASSIFY CPitchClassSet::Classify(WORD nMask)
+{
+	const MASK_CLASS&	mc = GetMaskClass(nMask);
+	CLASSIFY	cls;
+	if (mc.iPrime == NO_PRIME) {	// if empty mask
+		cls.idPrime = 0;
+		cls.idInverse = 0;
+		cls.iPrime = -1;
+	} else {
+		cls.idPrime = m_arrPrimeForm[mc.iPrime].idPrime;
+		cls.idInverse = m_tblMaskClass.arrInverseId[mc.iPrime];
+		cls.iPrime = mc.iPrime;
+	}
+	cls.nTranspose = mc.nTranspose;
+	cls.bInverted = mc.bInverted != 0;
+	return cls;
+}
+
+void CPitchClassSet::ClassifyBlock(const WORD *pMask, int iStart, int iEnd, const CLASSIFY_ARRAYS& arrs, const int *pPrimeFunc)
+{
+	// Per-prime results go in small tables indexed by the mask class's
+	// prime index, including NO_PRIME, so the inner loop is nothing but
+	// gathers and stores, with no branches on the data.
+	enum {
+		SLOTS = NO_PRIME + 1
+	};
+	int	arrPrime[SLOTS];
+	int	arrForte[SLOTS];
+	int	arrFunc[SLOTS];
+	for (int iSlot = 0; iSlot < SLOTS; iSlot++) {
+		bool	bIsPrime = iSlot < PRIME_FORMS;
+		arrPrime[iSlot] = bIsPrime ? iSlot : -1;
+		arrForte[iSlot] = iSlot >= FORTE_FIRST && iSlot <= FORTE_LAST ? iSlot - FORTE_FIRST : -1;
+		arrFunc[iSlot] = bIsPrime && pPrimeFunc != NULL ? pPrimeFunc[iSlot] : -1;
 	}
-	return -1;
+	const MASK_CLASS	*pClass = m_tblMaskClass.arrMaskClass;
+	if (arrs.pPrime != NULL) {
+		for (int iMask = iStart; iMask < iEnd; iMask++)
+			arrs.pPrime[iMask] = arrPrime[pClass[pMask[iMask]].iPrime];
+	}
+	if (arrs.pForte != NULL) {
+		for (int iMask = iStart; iMask < iEnd; iMask++)
+			arrs.pForte[iMask] = arrForte[pClass[pMask[iMask]].iPrime];
+	}
+	if (arrs.pInverted != NULL) {
+		for (int iMask = iStart; iMask < iEnd; iMask++)
+			arrs.pInverted[iMask] = pClass[pMask[iMask]].bInverted != 0;
+	}
+	if (arrs.pTranspose != NULL) {
+		for (int iMask = iStart; iMask < iEnd; iMask++)
+			arrs.pTranspose[iMask] = pClass[pMask[iMask]].nTranspose;
+	}
+	if (arrs.pFunc != NULL) {
+		for (int iMask = iStart; iMask < iEnd; iMask++)
+			arrs.pFunc[iMask] = arrFunc[pClass[pMask[iMask]].iPrime];
+	}
+}
+
+void CPitchClassSet::Classify(const WORD *pMask, int nCount, const CLASSIFY_ARRAYS& arrs, const int *pPrimeFunc, int nThreads)
+{
+	// pPrimeFunc optionally points to an array of PRIME_FORMS values, one
+	// for each prime form, which is gathered into pFunc; large batches are
+	// split across threads, and each thread writes its own slice of outputs
+	ParallelFor(nCount, CLASSIFY_MIN_BLOCK, [pMask, &arrs, pPrimeFunc](int iStart, int iEnd) {
+		ClassifyBlock(pMask, iStart, iEnd, arrs, pPrimeFunc);
+	}, nThreads);
 }
 
 LPCTSTR	CPitchClassSet::GetForte() const
@@ -14,12 +14,21 @@
 		04		17jan23	improve portability
 		05		26jul24	FindForte now returns index of prime form
 		07		15sep25	add GetMask
+		08		17oct26	add mask classification table
+		09		17oct26	add perfect hash for FindForte
+		10		17oct26	add hashed Forte name index
+		11		17oct26	add interval vector kernel and Z-relation index
+		12		17oct26	add batch classification
+		13		17oct26	add complement classification
+		14		17oct26	bake prime form masks
+		15		17oct26	bake mask classification table
 
 */
 
 #pragma once
 
 #include "BoundArray.h"
+#include "NameIndex.h"
 #include "stdint.h"
 #include <string>
 
@@ -45,6 +54,31 @@ public:
 		FORTE_LAST = FORTE_FIRST + FORTE_CODES - 1,
 	};
 	typedef int INTERVAL_VECTOR[INTERVALS];
+	enum {
+		MASK_COUNT = 1 << OCTAVE,	// number of possible pitch class masks
+		MASK_ALL = MASK_COUNT - 1,	// mask containing every pitch class
+		NO_PRIME = 0xff,	// prime index of empty mask
+	};
+	struct MASK_CLASS {	// compact entry in mask classification table
+		BYTE	iPrime;		// index of prime form, or NO_PRIME if mask is empty
+		BYTE	nTranspose;	// transposition that maps prime form onto mask
+		BYTE	bInverted;	// non-zero if prime form must be inverted first
+		BYTE	nSize;		// number of pitch classes in mask
+	};
+	struct CLASSIFY {	// result of classifying a mask
+		SET_ID	idPrime;	// set ID of prime form
+		SET_ID	idInverse;	// set ID of prime form's inversion
+		int		iPrime;		// index of prime form, or -1 if mask is empty
+		int		nTranspose;	// transposition level from 0 to 11
+		bool	bInverted;	// true if mask is a transposition of inverted prime form
+	};
+	struct CLASSIFY_ARRAYS {	// output arrays for batch classification; any can be NULL
+		int		*pPrime;	// index of prime form, or -1 if mask is empty
+		int		*pForte;	// index of Forte code, or -1 if set has less than three or more than nine members
+		bool	*pInverted;	// true if mask is a transposition of inverted prime form
+		int		*pTranspose;	// transposition level from 0 to 11
+		int		*pFunc;		// caller-defined function of prime form, or -1 if mask is empty
+	};
 
 // Construction
 	CPitchClassSet();
@@ -58,6 +92,11 @@ public:
 	static	int		GetIntervalCount(SET_ID id);
 	void	GetIntervalVector(INTERVAL_VECTOR vec) const;
 	int		GetIntervalVector() const;
+	static	void	GetIntervalVector(WORD nMask, INTERVAL_VECTOR vec);
+	static	int		GetIntervalVector(WORD nMask);
+	static	int		GetPrimeIntervalVector(int iPrime);
+	static	int		GetZPartner(int iPrime);
+	static	int		GetComplement(int iPrime);
 	SET_ID	GetId() const;
 	LPCTSTR	GetForte() const;
 	static	SET_ID	GetPrimeId(int iPrime);
@@ -66,6 +105,8 @@ public:
 	bool	operator!=(const CPitchClassSet& set) const;
 	WORD	GetMask() const;
 	WORD	GetMask(int nTranspose) const;
+	static	const MASK_CLASS&	GetMaskClass(WORD nMask);
+	static	WORD	GetPrimeMask(int iPrime);
 
 // Operations
 	void	Dump() const;
@@ -80,14 +121,58 @@ public:
 	void	RemoveDuplicates();
 	void	MakePrimeForm();
 	static	int		FindForte(SET_ID id);
+	static	void	FindForte(const SET_ID *pID, int *pPrime, int nCount);
 	static	int		FindForte(LPCTSTR pszForte);
+	static	int		FindForte(LPCTSTR pszForte, int nLen, bool& bInverse);
+	static	CLASSIFY	Classify(WORD nMask);
+	static	void	Classify(const WORD *pMask, int nCount, const CLASSIFY_ARRAYS& arrs, const int *pPrimeFunc = NULL, int nThreads = 0);
+	static	WORD	RotateMask(WORD nMask, int nTranspose);
+	static	WORD	InvertMask(WORD nMask);
+	static	WORD	ComplementMask(WORD nMask);
+	static	int		CountBits(WORD nMask);
+	static	int		PackIntervalVector(const INTERVAL_VECTOR vec);
+	static	int		FindIntervalVector(int nIntVec, int *pPrime, int nMaxPrimes);
+
+	enum {
+		FORTE_HASH_BITS = 10,	// size of Forte hash table, in bits
+		FORTE_HASH_SIZE = 1 << FORTE_HASH_BITS,	// number of slots in Forte hash table
+		FORTE_NAME_SLOTS = 512,	// number of slots in Forte name index
+		FORTE_NAME_MAX = 8,	// maximum length of a Forte name, including terminator
+		INT_VEC_HASH_BITS = 9,	// size of interval vector hash table, in bits
+		INT_VEC_HASH_SIZE = 1 << INT_VEC_HASH_BITS,	// number of slots in interval vector hash table
+		CLASSIFY_MIN_BLOCK = 1 << 16,	// minimum number of masks per thread in batch classification
+	};
+	struct MASK_CLASS_TABLE {	// mask classification table, and per-prime tables derived from it
+		MASK_CLASS	arrMaskClass[MASK_COUNT];	// classification of each mask
+		SET_ID	arrInverseId[PRIME_FORMS];	// set ID of each prime form's inversion
+		int		arrPrimeIntVec[PRIME_FORMS];	// packed interval vector of each prime form
+		BYTE	arrZPartner[PRIME_FORMS];	// index of each prime form's Z-related set, or NO_PRIME
+		BYTE	arrComplement[PRIME_FORMS];	// index of each prime form's complement, or NO_PRIME
+		BYTE	arrIntVecHash[INT_VEC_HASH_SIZE];	// prime index for each interval vector hash slot
+	};
+	static	void	BuildMaskClassTable(MASK_CLASS_TABLE& tbl);
+	static	const MASK_CLASS_TABLE&	GetMaskClassTable();
 
 protected:
 	struct PRIME_FORM {
 		SET_ID	idPrime;	// set ID of prime form
 		LPCTSTR pszForte;	// prime form's Forte code
+		WORD	nMask;		// prime form's mask, computed from set ID at compile time
+	};
+	class CForteNameTable {
+	public:
+		CForteNameTable();
+		CNameIndex<FORTE_NAME_SLOTS>	m_idxName;	// maps Forte names to prime indices
+		TCHAR	m_arrPlainName[PRIME_FORMS][FORTE_NAME_MAX];	// Forte names without Z
 	};
 	static const PRIME_FORM m_arrPrimeForm[PRIME_FORMS];
+	static const MASK_CLASS_TABLE	m_tblMaskClass;	// generated by MakeMaskClassTable
+	static const CForteNameTable	m_tblForteName;
+	static const BYTE	m_arrForteHash[FORTE_HASH_SIZE];	// prime index for each hash slot
+
+// Helpers
+	static	int		HashIntervalVector(int nIntVec);
+	static	void	ClassifyBlock(const WORD *pMask, int iStart, int iEnd, const CLASSIFY_ARRAYS& arrs, const int *pPrimeFunc);
 };
 
 inline CPitchClassSet::CPitchClassSet()
@@ -123,3 +208,102 @@ inline bool CPitchClassSet::operator!=(const CPitchClassSet& set) const
 {
 	return !operator==(set);
 }
+
+inline const CPitchClassSet::MASK_CLASS& CPitchClassSet::GetMaskClass(WORD nMask)
+{
+	ASSERT(nMask < MASK_COUNT);
+	return m_tblMaskClass.arrMaskClass[nMask];
+}
+
+inline const CPitchClassSet::MASK_CLASS_TABLE& CPitchClassSet::GetMaskClassTable()
+{
+	return m_tblMaskClass;
+}
+
+inline WORD CPitchClassSet::GetPrimeMask(int iPrime)
+{
+	ASSERT(iPrime >= 0 && iPrime < PRIME_FORMS);
+	return m_arrPrimeForm[iPrime].nMask;
+}
+
+inline WORD CPitchClassSet::RotateMask(WORD nMask, int nTranspose)
+{
+	// transpose upward; assume transposition is from 0 to 11
+	ASSERT(nTranspose >= 0 && nTranspose < OCTAVE);
+	return static_cast<WORD>(((nMask << nTranspose) | (nMask >> (OCTAVE - nTranspose))) & MASK_ALL);
+}
+
+inline int CPitchClassSet::GetPrimeIntervalVector(int iPrime)
+{
+	ASSERT(iPrime >= 0 && iPrime < PRIME_FORMS);
+	return m_tblMaskClass.arrPrimeIntVec[iPrime];
+}
+
+inline int CPitchClassSet::GetZPartner(int iPrime)
+{
+	// returns index of Z-related prime form, or -1 if none
+	ASSERT(iPrime >= 0 && iPrime < PRIME_FORMS);
+	int	iPartner = m_tblMaskClass.arrZPartner[iPrime];
+	return iPartner != NO_PRIME ? iPartner : -1;
+}
+
+inline int CPitchClassSet::GetComplement(int iPrime)
+{
+	// returns index of complement's prime form, or -1 if complement is empty
+	ASSERT(iPrime >= 0 && iPrime < PRIME_FORMS);
+	int	iComplement = m_tblMaskClass.arrComplement[iPrime];
+	return iComplement != NO_PRIME ? iComplement : -1;
+}
+
+inline int CPitchClassSet::CountBits(WORD nMask)
+{
+	UINT	x = nMask;
+	x = x - ((x >> 1) & 0x5555);
+	x = (x & 0x3333) + ((x >> 2) & 0x3333);
+	x = (x + (x >> 4)) & 0x0f0f;
+	return static_cast<int>((x + (x >> 8)) & 0x1f);
+}
+
+inline void CPitchClassSet::GetIntervalVector(WORD nMask, INTERVAL_VECTOR vec)
+{
+	// each pair of pitch classes separated by interval class K contributes
+	// one bit to the mask ANDed with its rotation by K; the tritone is its
+	// own complement, so every tritone pair is counted twice
+	for (int iInt = 0; iInt < INTERVALS - 1; iInt++)
+		vec[iInt] = CountBits(nMask & RotateMask(nMask, iInt + 1));
+	vec[INTERVALS - 1] = CountBits(nMask & RotateMask(nMask, INTERVALS)) / 2;
+}
+
+inline int CPitchClassSet::GetIntervalVector(WORD nMask)
+{
+	INTERVAL_VECTOR	vec;
+	GetIntervalVector(nMask, vec);
+	return PackIntervalVector(vec);
+}
+
+inline int CPitchClassSet::PackIntervalVector(const INTERVAL_VECTOR vec)
+{
+	// first interval class is in the most significant nibble
+	int	iVec = 0;
+	for (int iInt = 0; iInt < INTERVALS; iInt++)
+		iVec |= vec[iInt] << ((INTERVALS - 1 - iInt) * 4);
+	return(iVec);
+}
+
+inline WORD CPitchClassSet::InvertMask(WORD nMask)
+{
+	// invert around zero, same as mapping each pitch class N to (12 - N) % 12
+	UINT	x = nMask;
+	x = ((x & 0x5555) << 1) | ((x >> 1) & 0x5555);	// reverse 16 bits
+	x = ((x & 0x3333) << 2) | ((x >> 2) & 0x3333);
+	x = ((x & 0x0f0f) << 4) | ((x >> 4) & 0x0f0f);
+	x = ((x & 0x00ff) << 8) | ((x >> 8) & 0x00ff);
+	x >>= 16 - OCTAVE;	// pitch class N is now at 11 - N
+	return RotateMask(static_cast<WORD>(x), 1);
+}
+
+inline WORD CPitchClassSet::ComplementMask(WORD nMask)
+{
+	ASSERT(nMask < MASK_COUNT);
+	return static_cast<WORD>(~nMask & MASK_ALL);
+}
@@ -0,0 +1,231 @@
+// Copyleft 2026 Chris Korda
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation; either version 2 of the License, or any later version.
+/*
+		chris korda
+
+		revision history:
+		rev		date	comments
+		00		17oct26	initial version
+
+		enumerate set classes as necklaces or bracelets
+
+*/
+
+#pragma once
+
+#include "EdoSet.h"
+#include "PitchClassSet.h"
+extern "C" {
+#include "_generate.h"
+};
+
+// CSetClassEnum visits each set class of an equal division of the octave
+// exactly once, without classifying or deduplicating raw sets. The binary
+// necklaces of length DIVISIONS are generated in lexicographic order by
+// gen_neck_lex, with zero meaning a member, so each necklace is the lexically
+// greatest rotation of its set's bit string, which is CEdoMask's canonical
+// rotation. Necklaces are set classes under transposition only; if bracelets
+// are wanted, a necklace is only visited if it's also CEdoMask's prime form,
+// i.e. if its inversion's canonical rotation isn't greater. Every visited set
+// starts at pitch class zero, except the empty set, so its set ID is simply
+// its interval sequence. Sets can also be filtered by size, and by whether
+// they contain a chromatic cluster, meaning CLUSTER_SIZE consecutive pitch
+// classes. None of the harmonized chords in m_arrPCSAlias contain a cluster,
+// so the filter excludes the same chords that the balanced Gray method does;
+// see the 6-20 remark there.
+
+template<int DIVISIONS>
+class CSetClassEnum {
+public:
+// Types
+	typedef CEdoMask<DIVISIONS> EDO;
+	typedef typename EDO::MASK MASK;
+	typedef CPitchClassSet::SET_ID SET_ID;
+	enum {
+		CLUSTER_SIZE = 3,	// number of consecutive pitch classes that form a cluster
+	};
+
+// Construction
+	CSetClassEnum();
+	CSetClassEnum(int nMinSize, int nMaxSize, bool bBracelets = true, bool bClusterFree = false);
+	void	Init(int nMinSize, int nMaxSize, bool bBracelets = true, bool bClusterFree = false);
+
+// Attributes
+	bool	IsDone() const;
+	MASK	GetMask() const;
+	int		GetSize() const;
+	bool	IsSetIdValid() const;
+	SET_ID	GetSetId() const;
+	static	bool	HasCluster(MASK nMask);
+
+// Operations
+	void	Reset();
+	void	Next();
+
+protected:
+// Data members
+	int		m_nMinSize;		// minimum number of members
+	int		m_nMaxSize;		// maximum number of members
+	bool	m_bBracelets;	// true if set classes include inversion
+	bool	m_bClusterFree;	// true if sets containing a cluster are skipped
+	bool	m_bDone;		// true if iteration is complete
+	MASK	m_nMask;		// mask of current set
+	int		m_nSize;		// number of members in current set
+	BYTE	m_arrNeck[DIVISIONS];	// current necklace; zero means member
+
+// Helpers
+	void	UpdateMask();
+	bool	IsWanted() const;
+};
+
+template<int DIVISIONS>
+inline CSetClassEnum<DIVISIONS>::CSetClassEnum()
+{
+	m_nMinSize = 0;
+	m_nMaxSize = 0;
+	m_bBracelets = true;
+	m_bClusterFree = false;
+	m_bDone = true;
+	m_nMask = 0;
+	m_nSize = 0;
+}
+
+template<int DIVISIONS>
+inline CSetClassEnum<DIVISIONS>::CSetClassEnum(int nMinSize, int nMaxSize, bool bBracelets, bool bClusterFree)
+{
+	Init(nMinSize, nMaxSize, bBracelets, bClusterFree);
+}
+
+template<int DIVISIONS>
+inline void CSetClassEnum<DIVISIONS>::Init(int nMinSize, int nMaxSize, bool bBracelets, bool bClusterFree)
+{
+	ASSERT(nMinSize >= 0 && nMaxSize <= DIVISIONS);
+	m_nMinSize = nMinSize;
+	m_nMaxSize = nMaxSize;
+	m_bBracelets = bBracelets;
+	m_bClusterFree = bClusterFree;
+	Reset();
+}
+
+template<int DIVISIONS>
+inline bool CSetClassEnum<DIVISIONS>::IsDone() const
+{
+	return m_bDone;
+}
+
+template<int DIVISIONS>
+inline typename CSetClassEnum<DIVISIONS>::MASK CSetClassEnum<DIVISIONS>::GetMask() const
+{
+	ASSERT(!m_bDone);
+	return m_nMask;
+}
+
+template<int DIVISIONS>
+inline int CSetClassEnum<DIVISIONS>::GetSize() const
+{
+	ASSERT(!m_bDone);
+	return m_nSize;
+}
+
+template<int DIVISIONS>
+inline bool CSetClassEnum<DIVISIONS>::IsSetIdValid() const
+{
+	// each interval must fit in a nibble; the empty set has no intervals
+	ASSERT(!m_bDone);
+	if (!m_nSize || m_nSize > CPitchClassSet::SET_ID_MAX_MEMBERS)
+		return false;
+	if (DIVISIONS < 16)	// if intervals can't overflow
+		return true;
+	int	nPrevPC = DIVISIONS;
+	for (int iPC = DIVISIONS - 1; iPC >= 0; iPC--) {	// same order as GetSetId
+		if (m_nMask & (static_cast<MASK>(1) << iPC)) {
+			if (nPrevPC - iPC > 0xf)	// if interval too big for nibble
+				return false;
+			nPrevPC = iPC;
+		}
+	}
+	return true;
+}
+
+template<int DIVISIONS>
+inline typename CSetClassEnum<DIVISIONS>::SET_ID CSetClassEnum<DIVISIONS>::GetSetId() const
+{
+	// same as CPitchClassSet::GetId for the set's members in ascending order
+	ASSERT(IsSetIdValid());
+	SET_ID	id = 0;
+	int	nPrevPC = DIVISIONS;
+	for (int iPC = DIVISIONS - 1; iPC >= 0; iPC--) {	// last interval goes in most significant nibble
+		if (m_nMask & (static_cast<MASK>(1) << iPC)) {
+			id <<= 4;
+			id |= nPrevPC - iPC;
+			nPrevPC = iPC;
+		}
+	}
+	return id;
+}
+
+template<int DIVISIONS>
+inline bool CSetClassEnum<DIVISIONS>::HasCluster(MASK nMask)
+{
+	MASK	nCluster = nMask;
+	for (int iPC = 1; iPC < CLUSTER_SIZE; iPC++)
+		nCluster &= EDO::Rotate(nMask, iPC % DIVISIONS);
+	return nCluster != 0;
+}
+
+template<int DIVISIONS>
+inline void CSetClassEnum<DIVISIONS>::UpdateMask()
+{
+	MASK	nMask = 0;
+	int	nSize = 0;
+	for (int iPC = 0; iPC < DIVISIONS; iPC++) {
+		if (!m_arrNeck[iPC]) {	// if member
+			nMask |= static_cast<MASK>(1) << iPC;
+			nSize++;
+		}
+	}
+	m_nMask = nMask;
+	m_nSize = nSize;
+}
+
+template<int DIVISIONS>
+inline bool CSetClassEnum<DIVISIONS>::IsWanted() const
+{
+	if (m_nSize < m_nMinSize || m_nSize > m_nMaxSize)
+		return false;
+	if (m_bClusterFree && HasCluster(m_nMask))
+		return false;
+	if (m_bBracelets) {	// if inversions are equivalent
+		MASK	nInverse = EDO::Canonicalize(EDO::Invert(m_nMask));
+		if (EDO::IsGreater(nInverse, m_nMask))	// if inversion is the prime form
+			return false;
+	}
+	return true;
+}
+
+template<int DIVISIONS>
+inline void CSetClassEnum<DIVISIONS>::Reset()
+{
+	static_assert(DIVISIONS <= UCHAR_MAX, "too many divisions for generator");
+	m_bDone = gen_neck_lex_init(m_arrNeck, 2, DIVISIONS) != GEN_NEXT;
+	if (!m_bDone) {
+		UpdateMask();
+		if (!IsWanted())
+			Next();
+	}
+}
+
+template<int DIVISIONS>
+inline void CSetClassEnum<DIVISIONS>::Next()
+{
+	ASSERT(!m_bDone);
+	do {
+		if (gen_neck_lex_next(m_arrNeck, 2, DIVISIONS) != GEN_NEXT) {
+			m_bDone = true;
+			return;
+		}
+		UpdateMask();
+	} while (!IsWanted());
+}
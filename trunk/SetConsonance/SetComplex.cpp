@@ -0,0 +1,75 @@
+// Copyleft 2026 Chris Korda
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation; either version 2 of the License, or any later version.
+/*
+		chris korda
+
+		revision history:
+		rev		date	comments
+		00		17oct26	initial version
+
+		Forte set complex relations between set classes
+
+*/
+
+#include "stdafx.h"
+#include "SetComplex.h"
+
+CSetComplex::CSetComplex()
+{
+	m_bCreated = false;
+}
+
+bool CSetComplex::IsRelatable(int nNexusSize, int nMemberSize)
+{
+	return nNexusSize >= MIN_SIZE && nNexusSize <= MAX_SIZE
+		&& nMemberSize >= MIN_SIZE && nMemberSize <= MAX_SIZE
+		&& nMemberSize != nNexusSize
+		&& nMemberSize != CPitchClassSet::OCTAVE - nNexusSize;
+}
+
+void CSetComplex::Create(const CSetEmbedding& emb)
+{
+	ASSERT(emb.IsCreated());
+	ZeroMemory(m_arrRel, sizeof(m_arrRel));
+	BYTE	arrSize[PRIME_FORMS];
+	for (int iPrime = 0; iPrime < PRIME_FORMS; iPrime++)
+		arrSize[iPrime] = static_cast<BYTE>(CPitchClassSet::CountBits(CPitchClassSet::GetPrimeMask(iPrime)));
+	for (int iNexus = 0; iNexus < PRIME_FORMS; iNexus++) {
+		int	iNexusComp = CPitchClassSet::GetComplement(iNexus);
+		for (int iMember = 0; iMember < PRIME_FORMS; iMember++) {
+			if (!IsRelatable(arrSize[iNexus], arrSize[iMember]))
+				continue;
+			int	iMemberComp = CPitchClassSet::GetComplement(iMember);
+			// complements of relatable sets are relatable too, so neither
+			// complement index can be -1; M' is included in N if and only if
+			// N' is included in M, so for K it suffices to test inclusion
+			// between M and N, and between M and N', in both directions
+			int	nRel = 0;
+			if (emb.IsIncluded(iMember, iNexus) || emb.IsIncluded(iNexus, iMember)
+			|| emb.IsIncluded(iMember, iNexusComp) || emb.IsIncluded(iNexusComp, iMember))
+				nRel |= REL_K;
+			// for Kh, M or M' must be included in both N and N'
+			if ((emb.IsIncluded(iMember, iNexus) && emb.IsIncluded(iMember, iNexusComp))
+			|| (emb.IsIncluded(iMemberComp, iNexus) && emb.IsIncluded(iMemberComp, iNexusComp)))
+				nRel |= REL_KH;
+			m_arrRel[iNexus][iMember] = static_cast<BYTE>(nRel);
+		}
+	}
+	m_bCreated = true;
+}
+
+int CSetComplex::GetComplex(int iNexus, int nRelation, int *pPrime) const
+{
+	// pPrime receives prime indices of members having any of the given
+	// relation bits, in prime order, and must have room for PRIME_FORMS;
+	// returns number of members found
+	const BYTE	*pRel = GetRelationRow(iNexus);
+	int	nFound = 0;
+	for (int iMember = 0; iMember < PRIME_FORMS; iMember++) {
+		if (pRel[iMember] & nRelation)
+			pPrime[nFound++] = iMember;
+	}
+	return nFound;
+}
@@ -0,0 +1,93 @@
+// Copyleft 2026 Chris Korda
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation; either version 2 of the License, or any later version.
+/*
+		chris korda
+
+		revision history:
+		rev		date	comments
+		00		17oct26	initial version
+
+		Forte set complex relations between set classes
+
+*/
+
+#pragma once
+
+#include "SetEmbedding.h"
+
+// A nexus set N and its complement N' define a set complex. A set M is in
+// the complex K(N) if M or its complement is included in N or N', and in the
+// subcomplex Kh(N) if M or its complement is included in both N and N'.
+// Following Forte, only sets with between three and nine members are
+// related, and M can't have the same size as N or N'. Inclusion is decided
+// by the embedding table, so the whole relation matrix is built with table
+// lookups. The matrix is indexed first by nexus and then by member.
+
+class CSetComplex {
+public:
+// Constants
+	enum {
+		PRIME_FORMS = CPitchClassSet::PRIME_FORMS,
+		MIN_SIZE = 3,	// smallest set that can be related
+		MAX_SIZE = 9,	// largest set that can be related
+	};
+	enum {	// relation bits
+		REL_K	= 0x01,	// member is in nexus's set complex
+		REL_KH	= 0x02,	// member is in nexus's closed subcomplex
+	};
+
+// Construction
+	CSetComplex();
+	void	Create(const CSetEmbedding& emb);
+
+// Attributes
+	bool	IsCreated() const;
+	int		GetRelation(int iNexus, int iMember) const;
+	bool	IsK(int iNexus, int iMember) const;
+	bool	IsKh(int iNexus, int iMember) const;
+	const BYTE	*GetRelationRow(int iNexus) const;
+
+// Operations
+	int		GetComplex(int iNexus, int nRelation, int *pPrime) const;
+
+protected:
+// Data members
+	BYTE	m_arrRel[PRIME_FORMS][PRIME_FORMS];	// relation bits, indexed by nexus then member
+	bool	m_bCreated;		// true if table is valid
+
+// Helpers
+	static	bool	IsRelatable(int nNexusSize, int nMemberSize);
+};
+
+inline bool CSetComplex::IsCreated() const
+{
+	return m_bCreated;
+}
+
+inline int CSetComplex::GetRelation(int iNexus, int iMember) const
+{
+	ASSERT(m_bCreated);
+	ASSERT(iNexus >= 0 && iNexus < PRIME_FORMS);
+	ASSERT(iMember >= 0 && iMember < PRIME_FORMS);
+	return m_arrRel[iNexus][iMember];
+}
+
+inline bool CSetComplex::IsK(int iNexus, int iMember) const
+{
+	return (GetRelation(iNexus, iMember) & REL_K) != 0;
+}
+
+inline bool CSetComplex::IsKh(int iNexus, int iMember) const
+{
+	return (GetRelation(iNexus, iMember) & REL_KH) != 0;
+}
+
+inline const BYTE *CSetComplex::GetRelationRow(int iNexus) const
+{
+	// returns relation bits of each prime form to given nexus
+	ASSERT(m_bCreated);
+	ASSERT(iNexus >= 0 && iNexus < PRIME_FORMS);
+	return m_arrRel[iNexus];
+}
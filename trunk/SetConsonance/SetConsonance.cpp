@@ -10,6 +10,39 @@
         00      16jan23	initial version
 		01		15sep25	use bitmasks for set equivalence
 		02		30sep25	fix mode of FN_4_17 (heptatonic only)
+		03		17oct26	add mask classification test
+		04		17oct26	add Forte hash generator and test
+		05		17oct26	add chord symbol index and progression parser
+		06		17oct26	add pitch class mask test
+		07		17oct26	add interval vector test
+		08		17oct26	add batch chord classification
+		09		17oct26	add equal temperament set test
+		10		17oct26	use mask classification table in FindHarmony
+		11		17oct26	add set embedding test
+		12		17oct26	add set similarity test
+		13		17oct26	add set complex test
+		14		17oct26	add bound array test
+		15		17oct26	only test harmonizations in Debug
+		16		17oct26	iterate spacing permutations as masks
+		17		17oct26	use packed interval sets for spacing permutations
+		18		17oct26	generate only valid spacings
+		19		17oct26	add ranking of spacings and common tone crawler leaves
+		20		17oct26	add set class enumeration test
+		21		17oct26	score spacings in parallel
+		22		17oct26	hash spacing keys to skip duplicates
+		23		17oct26	score spacings from mask tables
+		24		17oct26	add branch and bound spacing search
+		25		17oct26	score one spacing per symmetry class
+		26		17oct26	add top spacings and score histogram
+		27		17oct26	specialize spacing kernels by place count
+		28		17oct26	test harmonizations in all builds
+		29		17oct26	add thread pool test; scale spacing blocks by work
+		30		17oct26	pass spacing search options in a struct
+		31		17oct26	test spacing search on several threads; shut down thread pool
+		32		17oct26	report unharmonized prime forms in Debug
+		33		17oct26	validate set class inversions via set class enumeration
+		34		17oct26	store only key hashes when skipping duplicate spacings
+		35		17oct26	generate mask class and alias tables; build score table on first use
 
 */
 
@@ -20,9 +53,20 @@
 #include "stdint.h"	// standard sizes
 #include "string"
 #include "vector"
+#include "unordered_map"
+#include "atomic"
+#include "mutex"
 #include "PitchClassSet.h"
+#include "PitchClassMask.h"
+#include "EdoSet.h"
+#include "SetEmbedding.h"
+#include "SetSimilarity.h"
+#include "SetComplex.h"
 #include "BgSet.h"
 #include "IntervalSet.h"
+#include "MaskPermutation.h"
+#include "SetClassEnum.h"
+#include "ParallelFor.h"
 extern "C" { 
 #include "_generate.h"
 };
@@ -31,6 +75,7 @@ extern "C" {
 using namespace std;
 
 typedef vector<CIntervalSet> CIntervalSetArray;
+typedef vector<CPackedIntervalSet> CPackedIntervalSetArray;
 
 enum {
 	#define FORTEDEF(id, name, sym) FN_##sym,
@@ -48,6 +93,87 @@ void GetPermutations(const CIntervalSet& set, CIntervalSetArray& arrSet)
 	}
 }
 
+void GetPermutations(const CIntervalSetRange& range, CPackedIntervalSetArray& arrSet)
+{
+	int	nPerms = range.GetPermutationCount();
+	arrSet.resize(nPerms);
+	for (int iPerm = 0; iPerm < nPerms; iPerm++)
+		range.Unpack(iPerm, arrSet[iPerm]);
+}
+
+void GetSpacings(int nPlaces, int nSpaceAvail, CPackedIntervalSetArray& arrSpacing)
+{
+	// generate spacings whose sum doesn't exceed available space, in the
+	// same order as counting through all spacings with GetPermutations
+	ASSERT(nPlaces >= 0 && nPlaces <= MAX_PLACES);
+	ASSERT(nSpaceAvail >= 0 && nSpaceAvail <= UCHAR_MAX);
+	arrSpacing.clear();
+	CIntervalSet::SET	spacing;
+	spacing.dw = 0;
+	unsigned char	n = static_cast<unsigned char>(nSpaceAvail);
+	unsigned char	k = static_cast<unsigned char>(nPlaces);
+	if (gen_comp_weak_colex_init(spacing.b, n, k) != GEN_NEXT)
+		return;
+	do {
+		arrSpacing.push_back(CPackedIntervalSet(spacing));
+	} while (gen_comp_weak_colex_next(spacing.b, n, k) == GEN_NEXT);
+}
+
+int GetSpacingIndex(int nPlaces, int nSpaceAvail, const CPackedIntervalSet& spacing)
+{
+	// returns index of spacing within the output of GetSpacings
+	return static_cast<int>(gen_comp_weak_colex_rank(spacing.GetSet().b,
+		static_cast<unsigned char>(nSpaceAvail), static_cast<unsigned char>(nPlaces)));
+}
+
+bool GetSpacing(int nPlaces, int nSpaceAvail, int iSpacing, CPackedIntervalSet& spacing)
+{
+	// spacing receives the element at the given index within the output of
+	// GetSpacings, without generating the preceding spacings
+	CIntervalSet::SET	set;
+	set.dw = 0;
+	if (iSpacing < 0 || gen_comp_weak_colex_unrank(set.b, static_cast<unsigned char>(nSpaceAvail),
+		static_cast<unsigned char>(nPlaces), iSpacing) != GEN_NEXT)
+		return false;
+	spacing = CPackedIntervalSet(set);
+	return true;
+}
+
+// CSetSpacings holds a set along with all of its valid spacings, in the
+// order of GetSpacings, and the range that expands them to interval sets.
+
+class CSetSpacings {
+public:
+	CSetSpacings(const CIntervalSet::SET& rngSet);
+	int		GetCount() const;
+	void	GetSpacing(int iSpacePerm, CIntervalSet& spacing) const;
+	CIntervalSet	m_setTest;		// set being spaced
+	int		m_nSpaceAvail;		// number of pitches available for spacing
+	CIntervalSetRange	m_range;	// range of each spacing place
+	CPackedIntervalSetArray	m_arrSpacing;	// valid spacings
+};
+
+CSetSpacings::CSetSpacings(const CIntervalSet::SET& rngSet)
+{
+	m_setTest.Alloc(rngSet);
+	m_nSpaceAvail = MAX_PITCH_COUNT - m_setTest.GetRangeSum();
+	CIntervalSet::SET	rngSpacing = {0};
+	for (int iPlace = 0; iPlace < m_setTest.GetSize(); iPlace++)
+		rngSpacing.b[iPlace] = static_cast<BYTE>(m_nSpaceAvail + 1);
+	m_range.Alloc(rngSpacing);
+	GetSpacings(m_setTest.GetSize(), m_nSpaceAvail, m_arrSpacing);
+}
+
+inline int CSetSpacings::GetCount() const
+{
+	return static_cast<int>(m_arrSpacing.size());
+}
+
+inline void CSetSpacings::GetSpacing(int iSpacePerm, CIntervalSet& spacing) const
+{
+	m_range.Expand(m_arrSpacing[iSpacePerm], spacing);
+}
+
 void GetPermutations(const CIntervalSet& set, const CIntervalSet& spacing, CIntervalSetArray& arrSet)
 {
 	GetPermutations(set, arrSet);
@@ -73,6 +199,171 @@ void TestPitchClassSet()
 	printf("%s %s\n", set.FormatSet().c_str(), set.GetForte());
 }
 
+bool TestMaskClassification()
+{
+	int	nErrors = 0;
+	for (int nMask = 1; nMask < CPitchClassSet::MASK_COUNT; nMask++) {
+		CPitchClassSet	pcs;
+		for (int iPC = 0; iPC < CPitchClassSet::OCTAVE; iPC++) {
+			if (nMask & (1 << iPC))
+				pcs.Add(iPC);
+		}
+		CPitchClassSet::SET_ID	idInverse;
+		CPitchClassSet::SET_ID	idPrime = pcs.FindPrimeForm(&idInverse);
+		CPitchClassSet::CLASSIFY	cls = CPitchClassSet::Classify(static_cast<WORD>(nMask));
+		WORD	nTestMask = CPitchClassSet::GetPrimeMask(cls.iPrime);
+		if (cls.bInverted)
+			nTestMask = CPitchClassSet::InvertMask(nTestMask);
+		nTestMask = CPitchClassSet::RotateMask(nTestMask, cls.nTranspose);
+		if (cls.idPrime != idPrime || cls.idInverse != idInverse || nTestMask != nMask) {
+			printf("NG %03X %s\n", nMask, pcs.FormatSet().c_str());
+			nErrors++;
+		}
+	}
+	return !nErrors;
+}
+
+bool MakeForteHash(LPCTSTR pszOutPath)
+{
+	// search for a multiplier that hashes every prime form's set ID to a
+	// different slot, and output the result as a header file
+	uint64_t	nSeed = 0x9e3779b97f4a7c15ULL;	// fixed seed so output is reproducible
+	BYTE	arrSlot[CPitchClassSet::FORTE_HASH_SIZE];
+	const int	nShift = 64 - CPitchClassSet::FORTE_HASH_BITS;
+	const int	nMaxTries = INT_MAX;
+	for (int iTry = 0; iTry < nMaxTries; iTry++) {
+		nSeed ^= nSeed << 13;	// xorshift
+		nSeed ^= nSeed >> 7;
+		nSeed ^= nSeed << 17;
+		uint64_t	nMult = nSeed | 1;
+		memset(arrSlot, 0xff, sizeof(arrSlot));
+		int iPrime;
+		for (iPrime = 0; iPrime < CPitchClassSet::PRIME_FORMS; iPrime++) {
+			int	iSlot = static_cast<int>((CPitchClassSet::GetPrimeId(iPrime) * nMult) >> nShift);
+			if (arrSlot[iSlot] != 0xff)	// if collision
+				break;
+			arrSlot[iSlot] = static_cast<BYTE>(iPrime);
+		}
+		if (iPrime == CPitchClassSet::PRIME_FORMS) {	// if all prime forms hashed without collision
+			CStdioFile	fOut(pszOutPath, CFile::modeCreate | CFile::modeWrite);
+			CString	s, t;
+			fOut.WriteString(_T("// this table is generated by MakeForteHash in SetConsonance.cpp; don't edit it\n\n"));
+			s.Format(_T("#define FORTE_HASH_MULT 0x%016llxULL\n\n"), nMult);
+			fOut.WriteString(s);
+			fOut.WriteString(_T("const BYTE CPitchClassSet::m_arrForteHash[FORTE_HASH_SIZE] = {\n"));
+			for (int iSlot = 0; iSlot < CPitchClassSet::FORTE_HASH_SIZE; iSlot++) {
+				if (!(iSlot % 16))
+					s = '\t';
+				t.Format(_T("%d,"), arrSlot[iSlot]);
+				s += t;
+				if (iSlot % 16 == 15)
+					fOut.WriteString(s + '\n');
+				else
+					s += ' ';
+			}
+			fOut.WriteString(_T("};\n"));
+			printf("multiplier found after %d tries\n", iTry + 1);
+			return true;
+		}
+	}
+	printf("no multiplier found\n");
+	return false;
+}
+
+bool TestForteHash()
+{
+	int	nErrors = 0;
+	for (int nMask = 1; nMask < CPitchClassSet::MASK_COUNT; nMask++) {
+		CPitchClassSet	pcs;
+		for (int iPC = 0; iPC < CPitchClassSet::OCTAVE; iPC++) {
+			if (nMask & (1 << iPC))
+				pcs.Add(iPC);
+		}
+		CPitchClassSet::SET_ID	id = pcs.GetId();	// not necessarily a prime form
+		int	iExpected = -1;
+		for (int iPrime = 0; iPrime < CPitchClassSet::PRIME_FORMS; iPrime++) {
+			if (CPitchClassSet::GetPrimeId(iPrime) == id) {
+				iExpected = iPrime;
+				break;
+			}
+		}
+		int	iBatch;
+		CPitchClassSet::FindForte(&id, &iBatch, 1);
+		if (CPitchClassSet::FindForte(id) != iExpected || iBatch != iExpected) {
+			printf("NG %llx\n", id);
+			nErrors++;
+		}
+	}
+	return !nErrors;
+}
+
+void WriteTableRows(CStdioFile& fOut, const CStringArray& arrItem, int nItemsPerRow)
+{
+	// output items as a braced initializer list, one row per line
+	fOut.WriteString(_T("\t{\n"));
+	CString	s;
+	int	nItems = static_cast<int>(arrItem.GetSize());
+	for (int iItem = 0; iItem < nItems; iItem++) {
+		if (!(iItem % nItemsPerRow))
+			s = _T("\t\t");
+		s += arrItem[iItem] + ',';
+		if (iItem % nItemsPerRow == nItemsPerRow - 1 || iItem == nItems - 1)
+			fOut.WriteString(s + '\n');
+		else
+			s += ' ';
+	}
+	fOut.WriteString(_T("\t},\n"));
+}
+
+void MakeMaskClassTable(LPCTSTR pszOutPath)
+{
+	// build the mask classification table, and output it as a header file
+	CPitchClassSet::MASK_CLASS_TABLE	*pTbl = new CPitchClassSet::MASK_CLASS_TABLE;
+	CPitchClassSet::BuildMaskClassTable(*pTbl);
+	CStdioFile	fOut(pszOutPath, CFile::modeCreate | CFile::modeWrite);
+	CStringArray	arrItem;
+	CString	s;
+	fOut.WriteString(_T("// this table is generated by MakeMaskClassTable in SetConsonance.cpp; don't edit it\n\n"));
+	fOut.WriteString(_T("const CPitchClassSet::MASK_CLASS_TABLE CPitchClassSet::m_tblMaskClass = {\n"));
+	arrItem.SetSize(CPitchClassSet::MASK_COUNT);
+	for (int nMask = 0; nMask < CPitchClassSet::MASK_COUNT; nMask++) {
+		const CPitchClassSet::MASK_CLASS&	mc = pTbl->arrMaskClass[nMask];
+		arrItem[nMask].Format(_T("{%d, %d, %d, %d}"), mc.iPrime, mc.nTranspose, mc.bInverted, mc.nSize);
+	}
+	WriteTableRows(fOut, arrItem, 8);
+	arrItem.SetSize(CPitchClassSet::PRIME_FORMS);
+	for (int iPrime = 0; iPrime < CPitchClassSet::PRIME_FORMS; iPrime++)
+		arrItem[iPrime].Format(_T("0x%llxULL"), pTbl->arrInverseId[iPrime]);
+	WriteTableRows(fOut, arrItem, 8);
+	for (int iPrime = 0; iPrime < CPitchClassSet::PRIME_FORMS; iPrime++)
+		arrItem[iPrime].Format(_T("0x%06x"), pTbl->arrPrimeIntVec[iPrime]);
+	WriteTableRows(fOut, arrItem, 16);
+	for (int iPrime = 0; iPrime < CPitchClassSet::PRIME_FORMS; iPrime++)
+		arrItem[iPrime].Format(_T("%d"), pTbl->arrZPartner[iPrime]);
+	WriteTableRows(fOut, arrItem, 16);
+	for (int iPrime = 0; iPrime < CPitchClassSet::PRIME_FORMS; iPrime++)
+		arrItem[iPrime].Format(_T("%d"), pTbl->arrComplement[iPrime]);
+	WriteTableRows(fOut, arrItem, 16);
+	arrItem.SetSize(CPitchClassSet::INT_VEC_HASH_SIZE);
+	for (int iSlot = 0; iSlot < CPitchClassSet::INT_VEC_HASH_SIZE; iSlot++)
+		arrItem[iSlot].Format(_T("%d"), pTbl->arrIntVecHash[iSlot]);
+	WriteTableRows(fOut, arrItem, 16);
+	fOut.WriteString(_T("};\n"));
+	delete pTbl;
+}
+
+bool TestMaskClassTable()
+{
+	// the generated table must match the one computed from the prime form table
+	CPitchClassSet::MASK_CLASS_TABLE	*pTbl = new CPitchClassSet::MASK_CLASS_TABLE;
+	CPitchClassSet::BuildMaskClassTable(*pTbl);
+	bool	bPass = !memcmp(pTbl, &CPitchClassSet::GetMaskClassTable(), sizeof(*pTbl));
+	if (!bPass)
+		printf("NG mask class table is stale; rerun MakeMaskClassTable\n");
+	delete pTbl;
+	return bPass;
+}
+
 void TestIntervalSetPacking()
 {
 	static const CIntervalSet::SET rngTest = {3, 4, 5};
@@ -302,13 +593,42 @@ static const PCS_ALIAS m_arrPCSAlias[] = {
 
 };
 
-static const int FindAlias(int iPrime)
+struct ALIAS_TABLE {
+	int		arrAliasOfPrime[CPitchClassSet::PRIME_FORMS];	// index of each prime form's first alias, or -1
+	int		arrPrimeHarmFunc[CPitchClassSet::PRIME_FORMS];	// harmonic function of each prime form, or -1
+};
+
+void BuildAliasTable(ALIAS_TABLE& tbl)
 {
-	for (int iAlias = 0; iAlias < _countof(m_arrPCSAlias); iAlias++) {
-		if (m_arrPCSAlias[iAlias].iPrime == iPrime)
-			return iAlias;
+	// compute alias table from alias array; used by MakeAliasTable to
+	// generate AliasTable.h, and to verify it
+	for (int iPrime = 0; iPrime < CPitchClassSet::PRIME_FORMS; iPrime++) {
+		tbl.arrAliasOfPrime[iPrime] = -1;
+		tbl.arrPrimeHarmFunc[iPrime] = -1;
 	}
-	return -1;
+	for (int iAlias = _countof(m_arrPCSAlias) - 1; iAlias >= 0; iAlias--) {	// reverse order so first alias wins
+		int	iPrime = m_arrPCSAlias[iAlias].iPrime;
+		tbl.arrAliasOfPrime[iPrime] = iAlias;
+		tbl.arrPrimeHarmFunc[iPrime] = m_arrPCSAlias[iAlias].iHarmFunc;
+	}
+}
+
+#include "AliasTable.h"	// defines PCS_ALIAS_COUNT and m_tblAlias
+
+static_assert(_countof(m_arrPCSAlias) == PCS_ALIAS_COUNT, "alias table is stale; rerun MakeAliasTable");
+
+static inline int FindAlias(int iPrime)
+{
+	if (iPrime < 0)	// if unknown set
+		return -1;
+	ASSERT(iPrime < CPitchClassSet::PRIME_FORMS);
+	return m_tblAlias.arrAliasOfPrime[iPrime];
+}
+
+void ClassifyChords(const WORD *pMask, int nCount, const CPitchClassSet::CLASSIFY_ARRAYS& arrs, int nThreads = 0)
+{
+	// harmonic function is that of the prime form's first alias, as in CalcOptimalSetSpacing
+	CPitchClassSet::Classify(pMask, nCount, arrs, m_tblAlias.arrPrimeHarmFunc, nThreads);
 }
 
 void InvertSet(CPitchClassSet& pcs)
@@ -343,276 +663,2216 @@ void TestIntervalSetForte()
 	int	nPerms = setTest.GetPermutationCount();
 	for (int iPerm = 0; iPerm < nPerms; iPerm++) {
 		CPitchClassSet	pcs(arrSetSpaced[iPerm].GetData(), setTest.GetSize());
-		CPitchClassSet	pcsPrime(pcs);
-		pcsPrime.MakePrimeForm();
-		int	iPrime = CPitchClassSet::FindForte(pcsPrime.GetId());
+		int	iPrime = CPitchClassSet::GetMaskClass(pcs.GetMask()).iPrime;	// look up prime form instead of reducing to it
+		CPitchClassSet	pcsPrime(CPitchClassSet::GetPrimeId(iPrime));
 		int	iAlias = FindAlias(iPrime);
 		LPCTSTR	pszAlias = iAlias >= 0 ? m_arrPCSAlias[iAlias].pszAlias : _T("");
 		printf("%d\t%s\t%s\t%s\t%s\t%s\n", iPerm, arrSet[iPerm].FormatSet().c_str(), pcs.FormatSet().c_str(), pcsPrime.FormatSet().c_str(), pcsPrime.GetForte(), pszAlias);
 	}
 }
 
-int FindHarmony(const CPitchClassSet& pcs, int& iHarm, int& nKeyShift)
+int FindHarmony(WORD nMask, int& iHarm, int& nKeyShift)
+{
+	// The mask classification table tries plain transpositions of the prime
+	// form before inverted ones, in ascending order, so it gives the same
+	// harmonization and key shift as searching them one at a time would.
+	const CPitchClassSet::MASK_CLASS&	mc = CPitchClassSet::GetMaskClass(nMask);
+	iHarm = mc.bInverted;
+	nKeyShift = mc.nTranspose;
+	if (mc.iPrime == CPitchClassSet::NO_PRIME)	// if empty set
+		return -1;
+	int	iAlias = FindAlias(mc.iPrime);
+	if (iAlias < 0 || m_arrPCSAlias[iAlias].arrHarm[iHarm].nKey < 0)	// if no harmonization
+		return -1;
+	return iAlias;
+}
+
+int FindHarmony(const CPitchClassSet& pcs, int& iHarm, int& nKeyShift)
+{
+	return FindHarmony(pcs.GetMask(), iHarm, nKeyShift);
+}
+
+bool FindForte(const CIntervalSet& set, int& iAlias, int& iHarm, int& nKey, int& nRoot)
+{
+	WORD	nMask = 0;
+	int	nSize = set.GetSize();
+	for (int iPlace = 0; iPlace < nSize; iPlace++)
+		nMask |= 1 << set[iPlace];
+	int	nKeyShift;
+	iAlias = FindHarmony(nMask, iHarm, nKeyShift);
+	if (iAlias < 0)
+		return false;
+	const PCS_ALIAS& alias = m_arrPCSAlias[iAlias];
+	const HARMONIZATION& harm = alias.arrHarm[iHarm];
+	const int nTranspose = 0;
+	nKey = (harm.nKey + nKeyShift) % NOTES;
+	nRoot = (m_arrScaleInfo[harm.iScale].scale.arrTone[harm.nMode] + nKey + nTranspose) % NOTES;	
+	return true;
+}
+
+bool ForteReport(const CIntervalSet& set)
+{
+	int iAlias, iHarm, nKey, nRoot;
+	if (FindForte(set, iAlias, iHarm, nKey, nRoot)) {
+		LPCTSTR	pszChordType;
+		const PCS_ALIAS& alias = m_arrPCSAlias[iAlias];
+		const HARMONIZATION& harm = alias.arrHarm[iHarm];
+		if (harm.pszName != NULL)
+			pszChordType = harm.pszName;
+		else
+			pszChordType = alias.pszAlias;
+		CString	sChordName;
+		sChordName = m_arrNoteName[nRoot];
+		sChordName += pszChordType;
+		printf("%s\t%s\t%s\t%s\t%s\n", CPitchClassSet::GetForte(alias.iPrime), sChordName.GetString(), m_arrNoteName[nKey],
+			m_arrScaleInfo[harm.iScale].pszName, m_arrModeName[harm.nMode]);
+	} else {
+		printf("%s NOT FOUND\n", set.FormatSet().c_str());
+		return false;
+	}
+	return true;
+}
+
+bool ForteReport(const CIntervalSetArray& arrPerm)
+{
+	int	nPerms = static_cast<int>(arrPerm.size());
+	for (int iPerm = 0; iPerm < nPerms; iPerm++) {
+		if (!ForteReport(arrPerm[iPerm]))
+			return false;
+	}
+	return true;
+}
+
+typedef CBoundArray<BYTE, 96> CUniqueKey;
+
+enum {
+	SPACING_MIN_WORK = 1 << 16,	// minimum number of permutations scored per thread
+	SPACING_SAMPLE_PERMS = 16,	// number of permutations scored to order spacings for pruning
+};
+
+inline int GetSpacingMinBlock(int nPermsPerSpacing, int nMinWork = SPACING_MIN_WORK)
+{
+	// a spacing costs about one table lookup per permutation, so a block
+	// must have enough spacings to be worth handing to another thread
+	return max(nMinWork / max(nPermsPerSpacing, 1), 1);
+}
+
+struct SPACING_SCORE {	// score of one spacing, computed independently of the others
+	int		nTonics;	// number of permutations with tonic function
+	int		nSubdoms;	// number of permutations with subdominant function
+	int		nPerms;		// number of permutations
+	uint64_t	nKeyHash;	// multiset hash of permutations' prime indices
+};
+
+// A spacing's key is the multiset of prime forms its permutations produce.
+// Its hash is the sum of a random 64-bit value per prime form, as in Zobrist
+// hashing, so it's independent of order and costs one add per permutation.
+// Equal hashes are confirmed by comparing the keys' histograms.
+
+// Scoring a spacing only needs each permutation's harmonic function and
+// key hash, so both are tabulated for every mask, and a permutation costs
+// two table loads. The table is built on first use rather than at startup,
+// so launches that don't search for spacings don't pay for it.
+
+class CMaskScoreTable {
+public:
+	static	const CMaskScoreTable&	Get();
+	int		GetHarmFunc(WORD nMask) const;
+	signed char	m_arrHarmFunc[CPitchClassSet::MASK_COUNT];	// harmonic function of each mask, or -1
+	uint64_t	m_arrKeyHash[CPitchClassSet::MASK_COUNT];	// key hash of each mask's prime form
+	uint64_t	m_arrPrimeHash[CPitchClassSet::PRIME_FORMS];	// random value for each prime form
+
+protected:
+	CMaskScoreTable();
+	static	std::once_flag	m_flagBuilt;	// ensures table is built only once
+	static	const CMaskScoreTable	*m_pTable;	// built on first use, never destroyed
+};
+
+std::once_flag CMaskScoreTable::m_flagBuilt;
+const CMaskScoreTable *CMaskScoreTable::m_pTable;
+
+CMaskScoreTable::CMaskScoreTable()
+{
+	uint64_t	nSeed = 0x9e3779b97f4a7c15ULL;	// fixed seed so hashes are reproducible
+	for (int iPrime = 0; iPrime < CPitchClassSet::PRIME_FORMS; iPrime++) {
+		nSeed ^= nSeed << 13;	// xorshift
+		nSeed ^= nSeed >> 7;
+		nSeed ^= nSeed << 17;
+		m_arrPrimeHash[iPrime] = nSeed;
+	}
+	m_arrHarmFunc[0] = -1;	// empty set
+	m_arrKeyHash[0] = 0;
+	for (int nMask = 1; nMask < CPitchClassSet::MASK_COUNT; nMask++) {
+		int	iPrime = CPitchClassSet::GetMaskClass(static_cast<WORD>(nMask)).iPrime;
+		m_arrHarmFunc[nMask] = static_cast<signed char>(m_tblAlias.arrPrimeHarmFunc[iPrime]);
+		m_arrKeyHash[nMask] = m_arrPrimeHash[iPrime];
+	}
+}
+
+const CMaskScoreTable& CMaskScoreTable::Get()
+{
+	std::call_once(m_flagBuilt, [] { m_pTable = new CMaskScoreTable; });
+	return *m_pTable;
+}
+
+#ifdef _DEBUG
+static std::atomic<bool>	m_arrUnharmonizedReported[CPitchClassSet::PRIME_FORMS];	// true if prime form was reported
+#endif
+
+inline int CMaskScoreTable::GetHarmFunc(WORD nMask) const
+{
+	// returns harmonic function of mask's prime form, or -1 if the prime
+	// form has no harmonization, in which case the mask is neither tonic
+	// nor subdominant
+	int	nHarmFunc = m_arrHarmFunc[nMask];
+#ifdef _DEBUG
+	if (nHarmFunc < 0 && nMask) {	// if prime form has no harmonization
+		int	iPrime = CPitchClassSet::GetMaskClass(nMask).iPrime;
+		if (!m_arrUnharmonizedReported[iPrime].exchange(true))	// report each prime form once
+			TRACE("unharmonized prime form %s\n", CPitchClassSet::GetForte(iPrime));
+	}
+#endif
+	return nHarmFunc;
+}
+
+class CPrimeHistogram {	// number of a spacing's permutations that produce each prime form
+public:
+	CPrimeHistogram(const CIntervalSet& setTest, const CIntervalSet& spacing);
+	bool	operator==(const CPrimeHistogram& hist) const;
+	bool	operator!=(const CPrimeHistogram& hist) const;
+	int		m_arrCount[CPitchClassSet::PRIME_FORMS];	// count of each prime form
+};
+
+CPrimeHistogram::CPrimeHistogram(const CIntervalSet& setTest, const CIntervalSet& spacing)
+{
+	ZeroMemory(m_arrCount, sizeof(m_arrCount));
+	for (CMaskPermutation perm(setTest, spacing); !perm.IsDone(); perm.Next()) {
+		int	iPrime = CPitchClassSet::GetMaskClass(perm.GetMask()).iPrime;
+		ASSERT(iPrime < CPitchClassSet::PRIME_FORMS);
+		m_arrCount[iPrime]++;
+	}
+}
+
+inline bool CPrimeHistogram::operator==(const CPrimeHistogram& hist) const
+{
+	return !memcmp(m_arrCount, hist.m_arrCount, sizeof(m_arrCount));
+}
+
+inline bool CPrimeHistogram::operator!=(const CPrimeHistogram& hist) const
+{
+	return !operator==(hist);
+}
+
+void FindDuplicateSpacings(const CSetSpacings& spacings, const vector<int>& arrClassRep, const vector<SPACING_SCORE>& arrScore, vector<int>& arrFirst)
+{
+	// for each spacing, find the first spacing with the same key, which may be
+	// itself; only hashes are stored, and a hash match is confirmed by building
+	// the histograms of the two spacings, unless they're in the same symmetry
+	// class, in which case their keys are equal by construction
+	const CIntervalSet&	setTest = spacings.m_setTest;
+	int	nSpacePerms = static_cast<int>(arrScore.size());
+	arrFirst.resize(nSpacePerms);
+	unordered_multimap<uint64_t, int>	mapHash;
+	mapHash.reserve(nSpacePerms);
+	CIntervalSet	spacing, spacingFirst;
+	for (int iSpacePerm = 0; iSpacePerm < nSpacePerms; iSpacePerm++) {
+		uint64_t	nHash = arrScore[iSpacePerm].nKeyHash;
+		int	iFirst = iSpacePerm;
+		pair<unordered_multimap<uint64_t, int>::const_iterator, unordered_multimap<uint64_t, int>::const_iterator>
+			range = mapHash.equal_range(nHash);
+		for (; range.first != range.second; ++range.first) {
+			int	iCandidate = range.first->second;
+			if (arrClassRep[iCandidate] != arrClassRep[iSpacePerm]) {	// if different symmetry classes
+				spacings.GetSpacing(iSpacePerm, spacing);
+				spacings.GetSpacing(iCandidate, spacingFirst);
+				if (CPrimeHistogram(setTest, spacingFirst) != CPrimeHistogram(setTest, spacing))	// if hash collision
+					continue;
+			}
+			iFirst = iCandidate;	// same key
+			break;
+		}
+		if (iFirst == iSpacePerm)	// if key is new
+			mapHash.insert(make_pair(nHash, iSpacePerm));
+		arrFirst[iSpacePerm] = iFirst;
+	}
+}
+
+inline uint64_t PackSpacingScore(int nTonics, int nSubdoms, int iSpacePerm, int nSpacePerms)
+{
+	// lower index packs higher, so that ties go to the first spacing
+	return (static_cast<uint64_t>(nTonics) << 48) | (static_cast<uint64_t>(nSubdoms) << 32)
+		| static_cast<uint32_t>(nSpacePerms - iSpacePerm);
+}
+
+// The spacing kernels are instantiated for each place count, so that their
+// permutation loops are unrolled; see CFixedMaskPermutation. Each kernel's
+// per-mask work is done by a callback object, and a search looks up the
+// kernels for its place count once, rather than per spacing or permutation.
+
+class CScoreSpacingFunc {	// accumulates a spacing's full score
+public:
+	CScoreSpacingFunc(SPACING_SCORE& score) : m_score(score), m_tblScore(CMaskScoreTable::Get())
+	{
+		score.nTonics = 0;
+		score.nSubdoms = 0;
+		score.nPerms = 0;
+		score.nKeyHash = 0;
+	}
+	bool operator()(WORD nMask)
+	{
+		m_score.nKeyHash += m_tblScore.m_arrKeyHash[nMask];
+		switch (m_tblScore.GetHarmFunc(nMask)) {
+		case HF_TONIC:
+			m_score.nTonics++;
+			break;
+		case HF_SUBDOM:
+			m_score.nSubdoms++;
+			break;
+		}
+		m_score.nPerms++;
+		return true;
+	}
+	SPACING_SCORE&	m_score;	// receives score
+	const CMaskScoreTable&	m_tblScore;	// mask score table
+};
+
+class CSampleSpacingFunc {	// counts tonics and subdominants among the first few permutations
+public:
+	CSampleSpacingFunc(int nPerms) : m_nTonics(0), m_nSubdoms(0), m_nPermsLeft(nPerms), m_tblScore(CMaskScoreTable::Get()) {}
+	bool operator()(WORD nMask)
+	{
+		switch (m_tblScore.GetHarmFunc(nMask)) {
+		case HF_TONIC:
+			m_nTonics++;
+			break;
+		case HF_SUBDOM:
+			m_nSubdoms++;
+			break;
+		}
+		return --m_nPermsLeft > 0;	// stop after sample is complete
+	}
+	int		m_nTonics;		// number of tonics so far
+	int		m_nSubdoms;		// number of subdominants so far
+	int		m_nPermsLeft;	// number of permutations left in sample
+	const CMaskScoreTable&	m_tblScore;	// mask score table
+};
+
+class CPrunedSpacingFunc {	// counts tonics and subdominants until best can't be beaten
+public:
+	CPrunedSpacingFunc(int nPerms, int iSpacePerm, int nSpacePerms, const std::atomic<uint64_t>& nBestScore) :
+		m_nTonics(0), m_nSubdoms(0), m_nPermsLeft(nPerms), m_iSpacePerm(iSpacePerm), m_nSpacePerms(nSpacePerms), m_nBestScore(nBestScore),
+		m_tblScore(CMaskScoreTable::Get()) {}
+	bool operator()(WORD nMask)
+	{
+		if (PackSpacingScore(m_nTonics + m_nPermsLeft, m_nSubdoms, m_iSpacePerm, m_nSpacePerms)
+		< m_nBestScore.load(std::memory_order_relaxed))	// if can't beat best even if all remaining are tonic
+			return false;
+		switch (m_tblScore.GetHarmFunc(nMask)) {
+		case HF_TONIC:
+			m_nTonics++;
+			break;
+		case HF_SUBDOM:
+			m_nSubdoms++;
+			break;
+		}
+		m_nPermsLeft--;
+		return true;
+	}
+	int		m_nTonics;		// number of tonics so far
+	int		m_nSubdoms;		// number of subdominants so far
+	int		m_nPermsLeft;	// number of permutations not yet scored
+	int		m_iSpacePerm;	// index of spacing
+	int		m_nSpacePerms;	// number of spacings
+	const std::atomic<uint64_t>&	m_nBestScore;	// best packed score so far
+	const CMaskScoreTable&	m_tblScore;	// mask score table
+};
+
+template<int PLACES>
+class CSpacingKernel {
+public:
+	static void Score(const CIntervalSet& setTest, const CIntervalSet& spacing, SPACING_SCORE& score)
+	{
+		CFixedMaskPermutation<PLACES>	perm(setTest, spacing);
+		CScoreSpacingFunc	func(score);
+		perm.ForEach(func);
+	}
+	static uint64_t Sample(const CIntervalSet& setTest, const CIntervalSet& spacing, int iSpacePerm, int nSpacePerms)
+	{
+		// returns packed score of first few permutations
+		CFixedMaskPermutation<PLACES>	perm(setTest, spacing);
+		CSampleSpacingFunc	func(SPACING_SAMPLE_PERMS);
+		perm.ForEach(func);
+		return PackSpacingScore(func.m_nTonics, func.m_nSubdoms, iSpacePerm, nSpacePerms);
+	}
+	static bool ScorePruned(const CIntervalSet& setTest, const CIntervalSet& spacing, int iSpacePerm, int nSpacePerms, std::atomic<uint64_t>& nBestScore)
+	{
+		// returns true if spacing was fully scored and became the best so far
+		CFixedMaskPermutation<PLACES>	perm(setTest, spacing);
+		CPrunedSpacingFunc	func(perm.GetCount(), iSpacePerm, nSpacePerms, nBestScore);
+		if (!perm.ForEach(func))	// if pruned
+			return false;
+		uint64_t	nScore = PackSpacingScore(func.m_nTonics, func.m_nSubdoms, iSpacePerm, nSpacePerms);
+		uint64_t	nBest = nBestScore.load();
+		while (nScore > nBest) {	// atomic maximum
+			if (nBestScore.compare_exchange_weak(nBest, nScore))
+				return true;
+		}
+		return false;
+	}
+};
+
+struct SPACING_KERNEL {	// spacing kernels for one place count
+	void	(*pScore)(const CIntervalSet& setTest, const CIntervalSet& spacing, SPACING_SCORE& score);
+	uint64_t	(*pSample)(const CIntervalSet& setTest, const CIntervalSet& spacing, int iSpacePerm, int nSpacePerms);
+	bool	(*pScorePruned)(const CIntervalSet& setTest, const CIntervalSet& spacing, int iSpacePerm, int nSpacePerms, std::atomic<uint64_t>& nBestScore);
+};
+
+#define SPACING_KERNEL_DEF(places) {CSpacingKernel<places>::Score, CSpacingKernel<places>::Sample, CSpacingKernel<places>::ScorePruned},
+static const SPACING_KERNEL m_arrSpacingKernel[MAX_PLACES] = {	// indexed by place count minus one
+	SPACING_KERNEL_DEF(1)
+	SPACING_KERNEL_DEF(2)
+	SPACING_KERNEL_DEF(3)
+	SPACING_KERNEL_DEF(4)
+	SPACING_KERNEL_DEF(5)
+	SPACING_KERNEL_DEF(6)
+	SPACING_KERNEL_DEF(7)
+	SPACING_KERNEL_DEF(8)
+};
+#undef SPACING_KERNEL_DEF
+
+inline const SPACING_KERNEL& GetSpacingKernel(int nPlaces)
+{
+	ASSERT(nPlaces >= 1 && nPlaces <= MAX_PLACES);
+	return m_arrSpacingKernel[nPlaces - 1];
+}
+
+void ScoreSpacing(const CIntervalSet& setTest, const CIntervalSet& spacing, SPACING_SCORE& score)
+{
+	GetSpacingKernel(setTest.GetSize()).pScore(setTest, spacing, score);
+}
+
+// Spacings are equivalent if their voicings are transpositions or inversions
+// of each other. The set's places occupy windows around the octave, and the
+// permutations of a spacing are all choices of one pitch per window, so only
+// the gaps between windows matter, including the gap from the last window
+// back around to the first; the last spacing doesn't move any window, so it
+// has no effect at all. Rotating the windows' order, or reflecting it, maps
+// every voicing to a transposition or inversion of itself, which has the same
+// prime form, provided the windows' ranges land in the same order. So the
+// gap sequence is canonicalized under those rotations and reflections that
+// preserve the range sequence, and equivalent spacings have equal scores and
+// keys, and only need to be scored once.
+
+void FindSpacingClasses(const CIntervalSet& setTest, const CPackedIntervalSetArray& arrSpacingPerm, vector<int>& arrRep)
+{
+	// for each spacing, find the first spacing in the same class, which may be itself
+	int	nPlaces = setTest.GetSize();
+	int	nSpacePerms = static_cast<int>(arrSpacingPerm.size());
+	int	nRangeSum = setTest.GetRangeSum();
+	int	arrRange[MAX_PLACES];
+	for (int iPlace = 0; iPlace < nPlaces; iPlace++)
+		arrRange[iPlace] = setTest.GetRange(iPlace);
+	// find rotations and reflections that preserve range sequence
+	bool	arrRotate[MAX_PLACES], arrReflect[MAX_PLACES];
+	for (int nShift = 0; nShift < nPlaces; nShift++) {
+		arrRotate[nShift] = true;
+		arrReflect[nShift] = true;
+		for (int iPlace = 0; iPlace < nPlaces; iPlace++) {
+			if (arrRange[(nShift + iPlace) % nPlaces] != arrRange[iPlace])
+				arrRotate[nShift] = false;
+			if (arrRange[(nShift - iPlace + nPlaces) % nPlaces] != arrRange[iPlace])
+				arrReflect[nShift] = false;
+		}
+	}
+	arrRep.resize(nSpacePerms);
+	unordered_map<uint64_t, int>	mapClass;
+	mapClass.reserve(nSpacePerms);
+	for (int iSpacePerm = 0; iSpacePerm < nSpacePerms; iSpacePerm++) {
+		const CPackedIntervalSet&	spacing = arrSpacingPerm[iSpacePerm];
+		int	arrGap[MAX_PLACES];	// gap after each window
+		int	nGapSum = 0;
+		for (int iPlace = 0; iPlace < nPlaces - 1; iPlace++) {
+			arrGap[iPlace] = spacing.GetAt(iPlace);
+			nGapSum += arrGap[iPlace];
+		}
+		arrGap[nPlaces - 1] = MAX_PITCH_COUNT - nRangeSum - nGapSum;	// wraps around to first window
+		uint64_t	nCanon = UINT64_MAX;
+		for (int nShift = 0; nShift < nPlaces; nShift++) {
+			if (arrRotate[nShift]) {	// windows in order nShift, nShift + 1, ...
+				uint64_t	nKey = 0;
+				for (int iPlace = 0; iPlace < nPlaces; iPlace++)
+					nKey = (nKey << 4) | arrGap[(nShift + iPlace) % nPlaces];
+				nCanon = min(nCanon, nKey);
+			}
+			if (arrReflect[nShift]) {	// windows in order nShift, nShift - 1, ...
+				uint64_t	nKey = 0;
+				for (int iPlace = 0; iPlace < nPlaces; iPlace++)
+					nKey = (nKey << 4) | arrGap[(nShift - iPlace - 1 + nPlaces * 2) % nPlaces];
+				nCanon = min(nCanon, nKey);
+			}
+		}
+		pair<unordered_map<uint64_t, int>::iterator, bool>	result = mapClass.insert(make_pair(nCanon, iSpacePerm));
+		arrRep[iSpacePerm] = result.first->second;	// if key already present, first spacing with it
+	}
+}
+
+// In pruning mode, the best spacing is found by branch and bound. A score
+// is packed into 64 bits so that (tonics, subdominants, lowest index) order
+// is plain integer order, and the best score so far is shared by all threads
+// as an atomic maximum. While a spacing is scored, the highest score it could
+// still reach is the one where every remaining permutation is a tonic, and
+// once that can't beat the best, scoring stops. A stale best only prunes
+// less, so the result is exact regardless of timing. Spacings are scored in
+// descending order of a sample of their first few permutations, claimed
+// from a shared counter, so strong bests are found early. Duplicate spacings
+// have the same score as their first occurrence and a higher index, so they
+// can never be best, and the result is the same with or without bSkipDups.
+
+bool FindBestSpacingPruned(const CSetSpacings& spacings, const vector<int>& arrSpaceRep, CIntervalSet& setBestSpacing, int nThreads, int nMinWork)
+{
+	// only the first spacing of each symmetry class can be best, because
+	// the others have the same score and a higher index
+	const CIntervalSet&	setTest = spacings.m_setTest;
+	int	nSpacePerms = spacings.GetCount();
+	int	nReps = static_cast<int>(arrSpaceRep.size());
+	const SPACING_KERNEL&	kernel = GetSpacingKernel(setTest.GetSize());
+	// order spacings by the score of a sample of their permutations
+	vector<uint64_t>	arrSample(nReps);
+	ParallelFor(nReps, GetSpacingMinBlock(min(setTest.GetPermutationCount(), int(SPACING_SAMPLE_PERMS)), nMinWork), [&](int iStart, int iEnd) {
+		CIntervalSet	spacing;
+		for (int iRep = iStart; iRep < iEnd; iRep++) {
+			int	iSpacePerm = arrSpaceRep[iRep];
+			spacings.GetSpacing(iSpacePerm, spacing);
+			arrSample[iRep] = kernel.pSample(setTest, spacing, iSpacePerm, nSpacePerms);
+		}
+	}, nThreads);
+	vector<int>	arrOrder(nReps);
+	for (int iRep = 0; iRep < nReps; iRep++)
+		arrOrder[iRep] = iRep;
+	sort(arrOrder.begin(), arrOrder.end(), [&arrSample](int a, int b) { return arrSample[a] > arrSample[b]; });
+	// a spacing must beat zero tonics and zero subdominants to be best, as in the exhaustive search
+	const uint64_t	nInitScore = PackSpacingScore(0, 0, -1, nSpacePerms);
+	std::atomic<uint64_t>	nBestScore(nInitScore);
+	std::atomic<int>	iNextOrder(0);
+	ParallelFor(nReps, GetSpacingMinBlock(setTest.GetPermutationCount(), nMinWork), [&](int iStart, int iEnd) {
+		CIntervalSet	spacing;
+		for (int iItem = iStart; iItem < iEnd; iItem++) {	// claim as many spacings as block size, in order
+			int	iSpacePerm = arrSpaceRep[arrOrder[iNextOrder++]];
+			spacings.GetSpacing(iSpacePerm, spacing);
+			kernel.pScorePruned(setTest, spacing, iSpacePerm, nSpacePerms, nBestScore);
+		}
+	}, nThreads);
+	uint64_t	nBest = nBestScore.load();
+	if (nBest == nInitScore)	// if no spacing beat the initial score
+		return false;
+	int	iBest = nSpacePerms - static_cast<int>(nBest & 0xffffffff);
+	spacings.GetSpacing(iBest, setBestSpacing);
+	return true;
+}
+
+// A spacing ranking is filled in by a single exhaustive search, as an
+// alternative to repeating the search with different overrides. It keeps
+// the best spacings in a bounded heap, ordered as the search orders them:
+// most tonics, then most subdominants, then lowest valid index. It also
+// counts how many valid spacings have each pair of tonic and subdominant
+// counts. Only indices and scores are stored, not spacings or permutations.
+
+struct RANKED_SPACING {	// one of a ranking's best spacings
+	int		nTonics;	// number of permutations with tonic function
+	int		nSubdoms;	// number of permutations with subdominant function
+	int		iValid;		// index among valid spacings; same as override index
+	int		iSpacing;	// index within GetSpacings output
+};
+
+class CSpacingRanking {
+public:
+// Construction
+	CSpacingRanking(int nTopCount = 10);
+	void	Reset(int nPerms);
+
+// Attributes
+	int		GetTopCount() const;
+	const RANKED_SPACING&	GetTop(int iTop) const;
+	int		GetPermCount() const;
+	int		GetHistogram(int nTonics, int nSubdoms) const;
+	int		GetValidCount() const;
+
+// Operations
+	void	Add(const RANKED_SPACING& spacing);
+	void	Sort();
+	void	Dump() const;
+
+protected:
+// Data members
+	int		m_nMaxTop;		// maximum number of best spacings to keep
+	int		m_nPerms;		// number of permutations per spacing
+	int		m_nValid;		// number of valid spacings added
+	bool	m_bSorted;		// true if best spacings are sorted, best first
+	vector<RANKED_SPACING>	m_arrTop;	// best spacings; a min-heap until sorted
+	vector<int>	m_arrHistogram;	// count for each tonic and subdominant count
+
+// Helpers
+	static	bool	IsBetter(const RANKED_SPACING& a, const RANKED_SPACING& b);
+};
+
+inline CSpacingRanking::CSpacingRanking(int nTopCount)
+{
+	m_nMaxTop = nTopCount;
+	Reset(0);
+}
+
+inline void CSpacingRanking::Reset(int nPerms)
+{
+	m_nPerms = nPerms;
+	m_nValid = 0;
+	m_bSorted = false;
+	m_arrTop.clear();
+	m_arrHistogram.assign((nPerms + 1) * (nPerms + 1), 0);
+}
+
+inline int CSpacingRanking::GetTopCount() const
+{
+	return static_cast<int>(m_arrTop.size());
+}
+
+inline const RANKED_SPACING& CSpacingRanking::GetTop(int iTop) const
+{
+	ASSERT(m_bSorted);
+	return m_arrTop[iTop];
+}
+
+inline int CSpacingRanking::GetPermCount() const
+{
+	return m_nPerms;
+}
+
+inline int CSpacingRanking::GetHistogram(int nTonics, int nSubdoms) const
+{
+	ASSERT(nTonics >= 0 && nTonics <= m_nPerms && nSubdoms >= 0 && nSubdoms <= m_nPerms);
+	return m_arrHistogram[nTonics * (m_nPerms + 1) + nSubdoms];
+}
+
+inline int CSpacingRanking::GetValidCount() const
+{
+	return m_nValid;
+}
+
+inline bool CSpacingRanking::IsBetter(const RANKED_SPACING& a, const RANKED_SPACING& b)
+{
+	if (a.nTonics != b.nTonics)
+		return a.nTonics > b.nTonics;
+	if (a.nSubdoms != b.nSubdoms)
+		return a.nSubdoms > b.nSubdoms;
+	return a.iValid < b.iValid;
+}
+
+void CSpacingRanking::Add(const RANKED_SPACING& spacing)
+{
+	ASSERT(!m_bSorted);
+	m_arrHistogram[spacing.nTonics * (m_nPerms + 1) + spacing.nSubdoms]++;
+	m_nValid++;
+	if (static_cast<int>(m_arrTop.size()) < m_nMaxTop) {	// if heap isn't full
+		m_arrTop.push_back(spacing);
+		push_heap(m_arrTop.begin(), m_arrTop.end(), IsBetter);	// worst spacing on top
+	} else if (m_nMaxTop > 0 && IsBetter(spacing, m_arrTop.front())) {	// if better than worst
+		pop_heap(m_arrTop.begin(), m_arrTop.end(), IsBetter);
+		m_arrTop.back() = spacing;
+		push_heap(m_arrTop.begin(), m_arrTop.end(), IsBetter);
+	}
+}
+
+void CSpacingRanking::Sort()
+{
+	if (!m_bSorted) {
+		sort_heap(m_arrTop.begin(), m_arrTop.end(), IsBetter);	// best first
+		m_bSorted = true;
+	}
+}
+
+void CSpacingRanking::Dump() const
+{
+	printf("valid spacings = %d\n", m_nValid);
+	printf("rank\toverride\tscore\n");
+	for (int iTop = 0; iTop < GetTopCount(); iTop++) {
+		const RANKED_SPACING&	top = GetTop(iTop);
+		printf("%d\t%d\t%d, %d\n", iTop, top.iValid, top.nTonics, top.nSubdoms);
+	}
+	printf("tonics\tsubdoms\tcount\n");
+	for (int nTonics = m_nPerms; nTonics >= 0; nTonics--) {
+		for (int nSubdoms = m_nPerms - nTonics; nSubdoms >= 0; nSubdoms--) {
+			int	nCount = GetHistogram(nTonics, nSubdoms);
+			if (nCount)
+				printf("%d\t%d\t%d\n", nTonics, nSubdoms, nCount);
+		}
+	}
+}
+
+struct SPACING_OPTIONS {	// options for optimal spacing search
+	SPACING_OPTIONS(int iOverride = -1, bool bSkipDups = false);
+	int		iOverride;		// if non-negative, index of valid spacing to select, regardless of optimality
+	bool	bSkipDups;		// true to exclude spacings whose keys duplicate an earlier spacing's
+	bool	bPrune;			// true to prune search; ignored if override, duplicate counts or ranking
+	int		nThreads;		// number of threads, or zero for all hardware threads
+	int		nMinWork;		// minimum number of permutations scored per thread
+	vector<int>	*parrDupCount;	// if non-null, receives number of spacings sharing each valid spacing's key
+	CSpacingRanking	*pRanking;	// if non-null, receives best spacings and score histogram
+};
+
+SPACING_OPTIONS::SPACING_OPTIONS(int iOverride, bool bSkipDups)
+{
+	this->iOverride = iOverride;
+	this->bSkipDups = bSkipDups;
+	bPrune = false;
+	nThreads = 0;
+	nMinWork = SPACING_MIN_WORK;
+	parrDupCount = NULL;
+	pRanking = NULL;
+}
+
+bool CalcOptimalSetSpacing(const CIntervalSet::SET& rngTest, CIntervalSet& m_setBestSpacing, const SPACING_OPTIONS& opts = SPACING_OPTIONS())
+{
+	// finds the spacing of rngTest whose permutations are most consonant;
+	// if ranking, every valid spacing is scored, even with an override
+	int	iOverride = opts.iOverride;
+	bool	bSkipDups = opts.bSkipDups;
+	vector<int>	*parrDupCount = opts.parrDupCount;
+	CSpacingRanking	*pRanking = opts.pRanking;
+	CSetSpacings	spacings(rngTest);
+	const CIntervalSet&	setTest = spacings.m_setTest;
+	const CPackedIntervalSetArray&	arrSpacingPerm = spacings.m_arrSpacing;
+	int	nSpacePerms = spacings.GetCount();
+	vector<int>	arrClassRep;	// index of first spacing in each spacing's symmetry class
+	FindSpacingClasses(setTest, arrSpacingPerm, arrClassRep);
+	vector<int>	arrSpaceRep;	// index of each symmetry class's first spacing
+	for (int iSpacePerm = 0; iSpacePerm < nSpacePerms; iSpacePerm++) {
+		if (arrClassRep[iSpacePerm] == iSpacePerm)
+			arrSpaceRep.push_back(iSpacePerm);
+	}
+	if (opts.bPrune && iOverride < 0 && parrDupCount == NULL && pRanking == NULL && !CONSOLE_NATTER)	// if pruning
+		return FindBestSpacingPruned(spacings, arrSpaceRep, m_setBestSpacing, opts.nThreads, opts.nMinWork);
+	// Spacings are scored independently, so they're split across threads,
+	// each of which writes its own slice of scores, including key hashes.
+	// Only one spacing per symmetry class is scored, and its
+	// results are copied to the rest of its class. The best spacing is then
+	// chosen serially in the original order, so ties, duplicates and
+	// overrides resolve as if every spacing were scored single-threaded.
+	vector<SPACING_SCORE>	arrScore(nSpacePerms);
+	int	nReps = static_cast<int>(arrSpaceRep.size());
+	const SPACING_KERNEL&	kernel = GetSpacingKernel(setTest.GetSize());
+	ParallelFor(nReps, GetSpacingMinBlock(setTest.GetPermutationCount(), opts.nMinWork), [&](int iStart, int iEnd) {
+		CIntervalSet	spacing;
+		for (int iRep = iStart; iRep < iEnd; iRep++) {
+			int	iSpacePerm = arrSpaceRep[iRep];
+			spacings.GetSpacing(iSpacePerm, spacing);
+			kernel.pScore(setTest, spacing, arrScore[iSpacePerm]);
+		}
+	}, opts.nThreads);
+	for (int iSpacePerm = 0; iSpacePerm < nSpacePerms; iSpacePerm++) {
+		int	iRep = arrClassRep[iSpacePerm];
+		if (iRep != iSpacePerm)	// if not first in its class
+			arrScore[iSpacePerm] = arrScore[iRep];
+	}
+	vector<int>	arrFirst;	// index of first spacing with same key
+	if (bSkipDups)	// if skipping duplicates
+		FindDuplicateSpacings(spacings, arrClassRep, arrScore, arrFirst);
+	if (parrDupCount != NULL) {	// if duplicate counts wanted
+		parrDupCount->clear();
+		if (bSkipDups) {
+			vector<int>	arrValidIdx(nSpacePerms);	// valid index of each spacing that's first with its key
+			for (int iSpacePerm = 0; iSpacePerm < nSpacePerms; iSpacePerm++) {
+				int	iFirst = arrFirst[iSpacePerm];
+				if (iFirst == iSpacePerm) {	// if first with this key
+					arrValidIdx[iSpacePerm] = static_cast<int>(parrDupCount->size());
+					parrDupCount->push_back(0);
+				}
+				(*parrDupCount)[arrValidIdx[iFirst]]++;
+			}
+		} else
+			parrDupCount->resize(nSpacePerms, 1);
+	}
+	int	nMostTonics = 0;
+	int	nMostSubdoms = 0;
+	int	nMostConsonantPerms = 0;
+	CIntervalSet	setBestSpacing;
+	int	nValidSpacePerms = 0;
+	int	nKnownBest = 5;
+	if (CONSOLE_NATTER) {
+		printf("iOverride = %d, bSkipDups = %d\n", iOverride, bSkipDups);
+		printf("index\tscore\tspacing\n");
+	}
+	bool	bOverrideFound = false;
+	if (pRanking != NULL)
+		pRanking->Reset(setTest.GetPermutationCount());
+	for (int iSpacePerm = 0; iSpacePerm < nSpacePerms; iSpacePerm++) {
+		ASSERT(arrSpacingPerm[iSpacePerm].GetSum() <= spacings.m_nSpaceAvail);
+		CIntervalSet	spacing;
+		spacings.GetSpacing(iSpacePerm, spacing);
+		int	nTonics = arrScore[iSpacePerm].nTonics;
+		int	nSubdoms = arrScore[iSpacePerm].nSubdoms;
+		// two permutations collide if they generate the same key (multiset of prime form indices)
+		if (bSkipDups && arrFirst[iSpacePerm] != iSpacePerm) {	// if key was previously encountered
+			continue;	// collision; skip duplicate
+		}
+//		spacing.Dump();
+		if (CONSOLE_NATTER) {
+			printf("%d\t%d, %d\t", nValidSpacePerms, nTonics, nSubdoms);
+			spacing.Dump();
+		}
+//		arrPerm[0].Dump();
+/*		if (nConsonant == nKnownBest) {
+			ForteReport(arrPerm);
+		}*/
+		bool	bIsOverride = nValidSpacePerms == iOverride;
+		if (bIsOverride)
+			bOverrideFound = true;
+		if (bIsOverride || (!bOverrideFound && (nTonics > nMostTonics || (nTonics == nMostTonics && nSubdoms > nMostSubdoms)))) {
+			nMostTonics = nTonics;
+			nMostSubdoms = nSubdoms;
+			nMostConsonantPerms = arrScore[iSpacePerm].nPerms;
+			setBestSpacing = spacing;
+		}
+		if (pRanking != NULL) {	// if ranking spacings
+			RANKED_SPACING	ranked = {nTonics, nSubdoms, nValidSpacePerms, iSpacePerm};
+			pRanking->Add(ranked);
+		}
+		nValidSpacePerms++;
+		if (bOverrideFound && pRanking == NULL)	// if override found and not ranking
+			break;
+	}
+	if (pRanking != NULL)
+		pRanking->Sort();
+	if (bOverrideFound) {
+		if (CONSOLE_NATTER) {
+			printf("override: using permutation %d\n", iOverride);
+		}
+	} else {
+		if (iOverride >= nValidSpacePerms) {
+			printf("override index is out of range\n");
+			return false;
+		}
+		if (CONSOLE_NATTER) {
+			printf("permutations = %d\n", nValidSpacePerms);
+		}
+	}
+	if (setBestSpacing.GetSize()) {
+		int	nPerms = nMostConsonantPerms;
+		if (CONSOLE_NATTER) {
+			printf("best:\t%d, %d (%.0f%%, %.0f%%)\t", nMostTonics, nMostSubdoms,
+				double(nMostTonics) / nPerms * 100, double(nMostSubdoms) / nPerms * 100);
+			setBestSpacing.Dump();
+//			ForteReport(arrMostConsonant);
+		}
+/*		for (int iPerm = 0; iPerm < nPerms; iPerm++) {
+			arrMostConsonant[iPerm].Dump();
+		}*/
+		m_setBestSpacing = setBestSpacing;
+		return true;
+	}
+	return false;
+}
+
+static const int m_arrIntervalSetCode[] = {
+#define INTERVAL_SET(code) {0x##code},
+#include "IntervalSetsList.h"
+};
+
+void CalcOptimalSpacingAllSets()
+{
+	for (int iSet = 0; iSet < _countof(m_arrIntervalSetCode); iSet++) {
+		int	nSetCode = m_arrIntervalSetCode[iSet];
+		CIntervalSet::SET	setSpan = {0};
+		int iPlace;
+		for (iPlace = 0; iPlace < MAX_PLACES; iPlace++) {
+			 int	nDigit = (nSetCode >> (iPlace * 4)) & 0xf;
+			 if (!nDigit)
+				 break;
+			 setSpan.b[iPlace] = nDigit;
+		}
+		// can't do hexachord due to missing harmonization for 6-20
+		if (iPlace >= 3 && iPlace <= 5) {	// if acceptable chord size
+			printf("{%X}\n", nSetCode);
+			CIntervalSet	setResult;
+			SPACING_OPTIONS	opts;
+			opts.bPrune = true;
+			CalcOptimalSetSpacing(setSpan, setResult, opts);
+		}
+	}
+}
+
+bool TestHarmonizations()
+{
+	int	nErrors = 0;
+	for (int iAlias = 0; iAlias < _countof(m_arrPCSAlias); iAlias++) {
+		const PCS_ALIAS	pcs = m_arrPCSAlias[iAlias];
+		CPitchClassSet	setRef(CPitchClassSet::GetPrimeId(pcs.iPrime));
+		for (int iHarm = 0; iHarm < NUM_HARMS; iHarm++) {
+			const HARMONIZATION& harm = pcs.arrHarm[iHarm];
+			if (harm.nKey >= 0) {
+				CBoundArray<int, OCTAVE> arrChordTone;
+				int	nChordTones = setRef.GetSize();
+				arrChordTone.SetSize(nChordTones);
+				const SCALE_INFO&	info = m_arrScaleInfo[harm.iScale];
+				int	nScaleLen = info.nLen;
+				for (int iTone = 0; iTone < nChordTones; iTone++) {
+					int	iScaleTone = (harm.arrTone[iTone] - 1 + harm.nMode) % nScaleLen;
+					arrChordTone[iTone] = (info.scale.arrTone[iScaleTone] + harm.nKey) % NOTES;
+				}
+				arrChordTone.Sort();
+				CPitchClassSet	setTest(arrChordTone.GetData(), nChordTones);
+				bool	bFound;
+				if (!iHarm) {
+					bFound = (setTest == setRef);
+				} else {
+					InvertSet(setRef);
+					bFound = EquivalentSet(setRef, setTest);
+				}
+				if (!bFound) {
+					printf("NG %s %s\n", CPitchClassSet::GetForte(pcs.iPrime), setRef.FormatSet().c_str());
+					for (int iTone = 0; iTone < nChordTones; iTone++) {
+						printf("%d ", arrChordTone[iTone]);
+					}
+					printf("\n");
+					nErrors++;
+				}
+			}
+		}
+	}
+	return !nErrors;
+}
+
+void MakeAliasTable(LPCTSTR pszOutPath)
+{
+	// build the alias table, and output it as a header file
+	ALIAS_TABLE	tbl;
+	BuildAliasTable(tbl);
+	CStdioFile	fOut(pszOutPath, CFile::modeCreate | CFile::modeWrite);
+	CStringArray	arrItem;
+	CString	s;
+	fOut.WriteString(_T("// this table is generated by MakeAliasTable in SetConsonance.cpp; don't edit it\n\n"));
+	s.Format(_T("#define PCS_ALIAS_COUNT %d\n\n"), _countof(m_arrPCSAlias));
+	fOut.WriteString(s);
+	fOut.WriteString(_T("static const ALIAS_TABLE m_tblAlias = {\n"));
+	arrItem.SetSize(CPitchClassSet::PRIME_FORMS);
+	for (int iPrime = 0; iPrime < CPitchClassSet::PRIME_FORMS; iPrime++)
+		arrItem[iPrime].Format(_T("%d"), tbl.arrAliasOfPrime[iPrime]);
+	WriteTableRows(fOut, arrItem, 16);
+	for (int iPrime = 0; iPrime < CPitchClassSet::PRIME_FORMS; iPrime++)
+		arrItem[iPrime].Format(_T("%d"), tbl.arrPrimeHarmFunc[iPrime]);
+	WriteTableRows(fOut, arrItem, 16);
+	fOut.WriteString(_T("};\n"));
+}
+
+bool TestAliasTable()
+{
+	// the generated table must match the one computed from the alias array
+	ALIAS_TABLE	tbl;
+	BuildAliasTable(tbl);
+	if (memcmp(&tbl, &m_tblAlias, sizeof(tbl))) {
+		printf("NG alias table is stale; rerun MakeAliasTable\n");
+		return false;
+	}
+	return true;
+}
+
+enum {
+	CHORD_SYMBOL_SLOTS = 256,	// number of slots in chord symbol index
+	MAX_CHORD_SYMBOLS = CHORD_SYMBOL_SLOTS / 2,	// keep index at most half full
+};
+
+struct CHORD_SYMBOL {
+	WORD	nMask;		// chord tones relative to root, as a pitch class mask
+	int		iAlias;		// index of alias that defines symbol
+	int		iHarm;		// index of harmonization within alias
+	int		nTertian;	// number of chord tones that form an unbroken stack of thirds
+	int		nTones;		// number of chord tones
+};
+
+static CNameIndex<CHORD_SYMBOL_SLOTS>	m_idxChordSymbol;	// maps chord symbols to m_arrChordSymbol
+static CBoundArray<CHORD_SYMBOL, MAX_CHORD_SYMBOLS>	m_arrChordSymbol;	// chord for each symbol
+
+static void AddChordSymbol(LPCTSTR pszSymbol, int nLen, const CHORD_SYMBOL& sym)
+{
+	// several harmonizations can share a symbol; prefer the smallest pure
+	// stack of thirds, else the longest stack of thirds from the root, then
+	// fewer tones, and finally whichever harmonization comes first in the table
+	int	iSym = m_idxChordSymbol.Find(pszSymbol, nLen);
+	if (iSym < 0) {	// if new symbol
+		iSym = m_arrChordSymbol.GetSize();
+		VERIFY(m_idxChordSymbol.Add(pszSymbol, nLen, iSym));
+		m_arrChordSymbol.Add(sym);
+	} else {	// symbol already defined
+		const CHORD_SYMBOL&	symPrev = m_arrChordSymbol[iSym];
+		bool	bIsStack = sym.nTertian == sym.nTones;
+		bool	bPrevIsStack = symPrev.nTertian == symPrev.nTones;
+		bool	bIsBetter;
+		if (bIsStack != bPrevIsStack)	// if only one of them is a pure stack
+			bIsBetter = bIsStack;
+		else if (bIsStack)	// both are pure stacks
+			bIsBetter = sym.nTones < symPrev.nTones;
+		else	// neither is a pure stack
+			bIsBetter = sym.nTertian > symPrev.nTertian
+				|| (sym.nTertian == symPrev.nTertian && sym.nTones < symPrev.nTones);
+		if (bIsBetter)
+			m_arrChordSymbol[iSym] = sym;
+	}
+}
+
+static void InitChordSymbols()
+{
+	static const int arrStack[] = {1, 3, 5, 7, 2, 4, 6};	// scale degrees in thirds
+	for (int iAlias = 0; iAlias < _countof(m_arrPCSAlias); iAlias++) {
+		const PCS_ALIAS&	alias = m_arrPCSAlias[iAlias];
+		int	nChordTones = CPitchClassSet(CPitchClassSet::GetPrimeId(alias.iPrime)).GetSize();
+		for (int iHarm = 0; iHarm < NUM_HARMS; iHarm++) {
+			const HARMONIZATION& harm = alias.arrHarm[iHarm];
+			if (harm.nKey < 0)	// if no harmonization
+				continue;
+			const SCALE_INFO&	info = m_arrScaleInfo[harm.iScale];
+			int	nRoot = (info.scale.arrTone[harm.nMode] + harm.nKey) % NOTES;
+			CHORD_SYMBOL	sym;
+			sym.nMask = 0;
+			sym.iAlias = iAlias;
+			sym.iHarm = iHarm;
+			sym.nTertian = 0;
+			sym.nTones = nChordTones;
+			for (int iTone = 0; iTone < nChordTones; iTone++) {
+				int	iScaleTone = (harm.arrTone[iTone] - 1 + harm.nMode) % info.nLen;
+				int	nTone = (info.scale.arrTone[iScaleTone] + harm.nKey) % NOTES;
+				sym.nMask |= 1 << ((nTone - nRoot + NOTES) % NOTES);
+			}
+			for (; sym.nTertian < _countof(arrStack); sym.nTertian++) {
+				const int	*pTone = harm.arrTone;
+				if (find(pTone, pTone + nChordTones, arrStack[sym.nTertian]) == pTone + nChordTones)
+					break;	// stack of thirds is broken
+			}
+			if (harm.pszName != NULL)	// if harmonization has its own name
+				AddChordSymbol(harm.pszName, static_cast<int>(_tcslen(harm.pszName)), sym);
+			LPCTSTR	pszPart = alias.pszAlias;
+			if (_tcschr(pszPart, ',') != NULL) {	// if alias lists one symbol per harmonization
+				for (int iPart = 0; iPart < iHarm && pszPart != NULL; iPart++) {
+					pszPart = _tcschr(pszPart, ',');
+					if (pszPart != NULL) {
+						pszPart++;	// skip comma
+						while (_istspace(*pszPart))
+							pszPart++;
+					}
+				}
+				if (pszPart != NULL)
+					AddChordSymbol(pszPart, static_cast<int>(_tcscspn(pszPart, _T(","))), sym);
+			} else if (harm.pszName == NULL)	// harmonization uses alias
+				AddChordSymbol(pszPart, static_cast<int>(_tcslen(pszPart)), sym);
+		}
+	}
+}
+
+static bool ParseNoteName(LPCTSTR pszNote, int nLen, int& iPos, int& nNote)
+{
+	static const int arrLetterNote[] = {A, B, C, D, E, F, G};
+	if (iPos >= nLen)
+		return false;
+	int	iLetter = _totupper(pszNote[iPos]) - 'A';
+	if (iLetter < 0 || iLetter >= _countof(arrLetterNote))
+		return false;
+	nNote = arrLetterNote[iLetter];
+	iPos++;
+	if (iPos < nLen) {	// optional accidental
+		if (pszNote[iPos] == 'b') {
+			nNote = (nNote + NOTES - 1) % NOTES;
+			iPos++;
+		} else if (pszNote[iPos] == '#') {
+			nNote = (nNote + 1) % NOTES;
+			iPos++;
+		}
+	}
+	return true;
+}
+
+static bool ParseChord(LPCTSTR pszChord, int nLen, WORD& nMask)
+{
+	if (_istdigit(pszChord[0])) {	// if Forte name
+		bool	bInverse;
+		int	iPrime = CPitchClassSet::FindForte(pszChord, nLen, bInverse);
+		if (iPrime < 0)
+			return false;
+		nMask = CPitchClassSet::GetPrimeMask(iPrime);
+		if (bInverse)
+			nMask = CPitchClassSet::InvertMask(nMask);
+		return true;
+	}
+	int	iPos = 0;
+	int	nRoot;
+	if (!ParseNoteName(pszChord, nLen, iPos, nRoot))
+		return false;
+	int	nSymbolEnd = nLen;
+	int	nBass = -1;
+	for (int iSlash = nLen - 1; iSlash >= iPos; iSlash--) {	// find last slash
+		if (pszChord[iSlash] == '/') {
+			int	iBassPos = iSlash + 1;
+			if (!ParseNoteName(pszChord, nLen, iBassPos, nBass) || iBassPos != nLen)
+				return false;	// slash must be followed by a bass note
+			nSymbolEnd = iSlash;
+			break;
+		}
+	}
+	int	iSym = m_idxChordSymbol.Find(pszChord + iPos, nSymbolEnd - iPos);
+	if (iSym < 0)
+		return false;
+	nMask = CPitchClassSet::RotateMask(m_arrChordSymbol[iSym].nMask, nRoot);
+	if (nBass >= 0)
+		nMask |= 1 << nBass;
+	return true;
+}
+
+bool ParseProgression(LPCTSTR pszText, CWordArray& arrMask)
+{
+	// Chords are separated by whitespace, commas or bar lines. A chord is a
+	// root followed by one of the symbols in m_arrPCSAlias and an optional
+	// slash bass, as in Bb-7b5/E; or a Forte name with an optional A or B
+	// suffix, as in 4-Z15B; or a percent sign to repeat the previous chord.
+	if (m_idxChordSymbol.IsEmpty())
+		InitChordSymbols();
+	arrMask.RemoveAll();
+	LPCTSTR	p = pszText;
+	while (*p) {
+		if (_istspace(*p) || *p == ',' || *p == '|') {
+			p++;
+			continue;
+		}
+		LPCTSTR	pszChord = p;
+		while (*p && !_istspace(*p) && *p != ',' && *p != '|')
+			p++;
+		int	nLen = static_cast<int>(p - pszChord);
+		WORD	nMask;
+		if (nLen == 1 && *pszChord == '%' && arrMask.GetSize())	// if repeat
+			nMask = arrMask[arrMask.GetSize() - 1];
+		else if (!ParseChord(pszChord, nLen, nMask)) {
+			printf("can't parse chord '%.*s'\n", nLen, pszChord);
+			return false;
+		}
+		arrMask.Add(nMask);
+	}
+	return true;
+}
+
+bool TestPitchClassMask()
+{
+	int	nErrors = 0;
+	for (int nMask = 1; nMask < CPitchClassSet::MASK_COUNT; nMask++) {
+		CPitchClassMask	mask(static_cast<WORD>(nMask));
+		CPitchClassSet	set;
+		mask.GetPitchClassSet(set);
+		if (CPitchClassMask(set) != mask || mask.GetSize() != set.GetSize()) {
+			printf("NG conversion %03x\n", nMask);
+			nErrors++;
+		}
+		for (int nTranspose = 0; nTranspose < CPitchClassSet::OCTAVE; nTranspose++) {
+			if (mask.Transpose(nTranspose).GetMask() != set.GetMask(nTranspose)
+			|| mask.Transpose(nTranspose - CPitchClassSet::OCTAVE) != mask.Transpose(nTranspose)) {
+				printf("NG transpose %03x %d\n", nMask, nTranspose);
+				nErrors++;
+			}
+		}
+		CPitchClassSet	setInv(set);
+		InvertSet(setInv);
+		if (mask.Invert() != CPitchClassMask(setInv)) {
+			printf("NG invert %03x\n", nMask);
+			nErrors++;
+		}
+		CPitchClassSet	setPrime(set);
+		setPrime.MakePrimeForm();
+		int	iPrime = CPitchClassSet::FindForte(setPrime.GetId());
+		if (mask.FindForte() != iPrime || mask.GetPrimeId() != setPrime.GetId()
+		|| mask.GetPrimeForm() != CPitchClassMask(setPrime)
+		|| !mask.IsEquivalent(mask.Invert().Transpose(nMask % CPitchClassSet::OCTAVE))) {
+			printf("NG prime %03x\n", nMask);
+			nErrors++;
+		}
+		if (mask.GetIntervalVector() != setPrime.GetIntervalVector()) {
+			printf("NG interval vector %03x\n", nMask);
+			nErrors++;
+		}
+	}
+	return !nErrors;
+}
+
+bool TestIntervalVector()
+{
+	int	nErrors = 0;
+	for (int nMask = 0; nMask < CPitchClassSet::MASK_COUNT; nMask++) {
+		CPitchClassSet::INTERVAL_VECTOR	vecRef, vec;
+		ZeroMemory(vecRef, sizeof(vecRef));
+		for (int i = 0; i < CPitchClassSet::OCTAVE - 1; i++) {	// for each pair of pitches
+			for (int j = i + 1; j < CPitchClassSet::OCTAVE; j++) {
+				if ((nMask & (1 << i)) && (nMask & (1 << j))) {
+					int	iInt = j - i;
+					if (iInt > CPitchClassSet::INTERVALS)
+						iInt = CPitchClassSet::OCTAVE - iInt;
+					vecRef[iInt - 1]++;
+				}
+			}
+		}
+		CPitchClassSet::GetIntervalVector(static_cast<WORD>(nMask), vec);
+		if (memcmp(vec, vecRef, sizeof(vec))) {
+			printf("NG interval vector %03x\n", nMask);
+			nErrors++;
+		}
+	}
+	int	nZSets = 0;
+	for (int iPrime = 0; iPrime < CPitchClassSet::PRIME_FORMS; iPrime++) {
+		int	nIntVec = CPitchClassSet::GetPrimeIntervalVector(iPrime);
+		CPitchClassSet	set(CPitchClassSet::GetPrimeId(iPrime));
+		int	arrPrime[2];
+		int	nFound = CPitchClassSet::FindIntervalVector(nIntVec, arrPrime, _countof(arrPrime));
+		int	iPartner = CPitchClassSet::GetZPartner(iPrime);
+		bool	bIsZ = _tcschr(CPitchClassSet::GetForte(iPrime), 'Z') != NULL;
+		if (nIntVec != set.GetIntervalVector() || nFound != (iPartner >= 0 ? 2 : 1)
+		|| find(arrPrime, arrPrime + nFound, iPrime) == arrPrime + nFound
+		|| bIsZ != (iPartner >= 0) || (iPartner >= 0 && CPitchClassSet::GetZPartner(iPartner) != iPrime)) {
+			printf("NG Z-relation %s\n", CPitchClassSet::GetForte(iPrime));
+			nErrors++;
+		}
+		if (iPartner > iPrime)
+			nZSets += 2;
+	}
+	if (nZSets != 46) {	// 23 Z-pairs
+		printf("NG %d Z-related sets\n", nZSets);
+		nErrors++;
+	}
+	return !nErrors;
+}
+
+bool TestClassifyChords()
+{
+	int	nErrors = 0;
+	const int	nMasks = CPitchClassSet::MASK_COUNT * 64;
+	vector<WORD>	arrMask(nMasks);
+	for (int iMask = 0; iMask < nMasks; iMask++)
+		arrMask[iMask] = static_cast<WORD>((iMask * 2654435761u >> 8) & CPitchClassSet::MASK_ALL);
+	vector<int>	arrPrime(nMasks), arrForte(nMasks), arrTranspose(nMasks), arrFunc(nMasks);
+	bool	*pInverted = new bool[nMasks];
+	CPitchClassSet::CLASSIFY_ARRAYS	arrs = {&arrPrime[0], &arrForte[0], pInverted, &arrTranspose[0], &arrFunc[0]};
+	for (int nThreads = 1; nThreads >= 0; nThreads--) {	// serial, then all hardware threads
+		ClassifyChords(&arrMask[0], nMasks, arrs, nThreads);
+		for (int iMask = 0; iMask < nMasks; iMask++) {
+			CPitchClassSet::CLASSIFY	cls = CPitchClassSet::Classify(arrMask[iMask]);
+			int	iForte = cls.iPrime >= CPitchClassSet::FORTE_FIRST && cls.iPrime <= CPitchClassSet::FORTE_LAST ?
+				cls.iPrime - CPitchClassSet::FORTE_FIRST : -1;
+			int	iAlias = cls.iPrime >= 0 ? FindAlias(cls.iPrime) : -1;
+			int	iHarmFunc = iAlias >= 0 ? m_arrPCSAlias[iAlias].iHarmFunc : -1;
+			if (arrPrime[iMask] != cls.iPrime || arrForte[iMask] != iForte || pInverted[iMask] != cls.bInverted
+			|| arrTranspose[iMask] != cls.nTranspose || arrFunc[iMask] != iHarmFunc) {
+				printf("NG classify %03x threads=%d\n", arrMask[iMask], nThreads);
+				nErrors++;
+				break;
+			}
+		}
+	}
+	delete [] pInverted;
+	return !nErrors;
+}
+
+template<int DIVISIONS>
+int CountNecklaces()
+{
+	// number of set classes under transposition only, including the empty set
+	uint64_t	nNecklaces = 0;
+	for (int d = 1; d <= DIVISIONS; d++) {
+		if (!(DIVISIONS % d)) {	// if d divides DIVISIONS
+			int	nPhi = 0;	// Euler's totient of d
+			for (int i = 1; i <= d; i++) {
+				int	a = i, b = d;
+				while (b) {	// greatest common divisor
+					int	t = a % b;
+					a = b;
+					b = t;
+				}
+				if (a == 1)
+					nPhi++;
+			}
+			nNecklaces += static_cast<uint64_t>(nPhi) << (DIVISIONS / d);
+		}
+	}
+	return static_cast<int>(nNecklaces / DIVISIONS);
+}
+
+template<int DIVISIONS>
+int CountBracelets()
+{
+	// number of set classes including the empty set, via Burnside's lemma
+	uint64_t	nNecklaces = CountNecklaces<DIVISIONS>();
+	if (DIVISIONS & 1)
+		return static_cast<int>(nNecklaces / 2 + (static_cast<uint64_t>(1) << (DIVISIONS - 1) / 2));
+	return static_cast<int>(nNecklaces / 2 + (static_cast<uint64_t>(3) << DIVISIONS / 2) / 4);
+}
+
+template<int DIVISIONS>
+bool TestEdoSet(int nMaskStep)
+{
+	typedef CEdoMask<DIVISIONS> EDO;
+	CEdoClassCache<DIVISIONS>	cache;
+	int	nErrors = 0;
+	int	nClasses = 0;
+	uint64_t	nMasks = static_cast<uint64_t>(EDO::GetMaskAll()) + 1;
+	for (uint64_t nMask = 0; nMask < nMasks; nMask += nMaskStep) {
+		typename EDO::MASK	m = static_cast<typename EDO::MASK>(nMask);
+		typename EDO::CLASSIFY	cls = EDO::Classify(m);
+		typename EDO::CLASSIFY	clsCache = cache.Classify(m);
+		typename EDO::MASK	nForm = cls.bInverted ? EDO::Invert(cls.nPrime) : cls.nPrime;
+		if (EDO::Rotate(nForm, cls.nTranspose) != m
+		|| clsCache.nPrime != cls.nPrime || clsCache.nTranspose != cls.nTranspose || clsCache.bInverted != cls.bInverted
+		|| EDO::Classify(EDO::Rotate(EDO::Invert(m), 1)).nPrime != cls.nPrime
+		|| EDO::Classify(cls.nPrime).nPrime != cls.nPrime) {
+			printf("NG %d-EDO %x\n", DIVISIONS, m);
+			nErrors++;
+		}
+		if (cls.nPrime == m)	// if mask is a prime form
+			nClasses++;
+	}
+	if (nMaskStep == 1) {	// if all masks were classified
+		int	nExpected = CountBracelets<DIVISIONS>();
+		if (nClasses != nExpected) {
+			printf("NG %d-EDO %d set classes, expected %d\n", DIVISIONS, nClasses, nExpected);
+			nErrors++;
+		}
+	}
+	return !nErrors;
+}
+
+bool TestEdoSets()
+{
+	// in 12-TET, set classes must match CPitchClassSet's
+	int	nErrors = 0;
+	BYTE	arrPrimeOfEdo[CPitchClassSet::MASK_COUNT];
+	memset(arrPrimeOfEdo, CPitchClassSet::NO_PRIME, sizeof(arrPrimeOfEdo));
+	for (int nMask = 1; nMask < CPitchClassSet::MASK_COUNT; nMask++) {
+		CEdoMask<12>::MASK	nPrime = CEdoMask<12>::Classify(nMask).nPrime;
+		int	iPrime = CPitchClassSet::GetMaskClass(static_cast<WORD>(nMask)).iPrime;
+		if (arrPrimeOfEdo[nPrime] == CPitchClassSet::NO_PRIME)
+			arrPrimeOfEdo[nPrime] = static_cast<BYTE>(iPrime);
+		if (arrPrimeOfEdo[nPrime] != iPrime
+		|| CPitchClassSet::GetMaskClass(static_cast<WORD>(nPrime)).iPrime != iPrime) {
+			printf("NG 12-EDO %03x\n", nMask);
+			nErrors++;
+		}
+	}
+	if (!TestEdoSet<12>(1) || !TestEdoSet<19>(1) || !TestEdoSet<22>(1) || !TestEdoSet<24>(7) || !TestEdoSet<32>(65521))
+		nErrors++;
+	return !nErrors;
+}
+
+template<int DIVISIONS>
+bool TestSetClassEnum(bool bBracelets)
+{
+	// each set class must be visited once, in canonical form, starting at zero
+	typedef CSetClassEnum<DIVISIONS> ENUM;
+	int	nErrors = 0;
+	int	nClasses = 0;
+	typename ENUM::MASK	nPrevMask = 0;
+	for (ENUM e(0, DIVISIONS, bBracelets); !e.IsDone(); e.Next()) {
+		typename ENUM::MASK	nMask = e.GetMask();
+		typename ENUM::MASK	nPrime = ENUM::EDO::Classify(nMask).nPrime;
+		if (ENUM::EDO::Canonicalize(nMask) != nMask || (bBracelets && nPrime != nMask)
+		|| (nClasses && !ENUM::EDO::IsGreater(nPrevMask, nMask))	// descending order
+		|| (nMask && !(nMask & 1)) || ENUM::EDO::CountBits(nMask) != e.GetSize()) {
+			printf("NG %d-EDO %x\n", DIVISIONS, nMask);
+			nErrors++;
+		}
+		nPrevMask = nMask;
+		nClasses++;
+	}
+	int	nExpected = bBracelets ? CountBracelets<DIVISIONS>() : CountNecklaces<DIVISIONS>();
+	if (nClasses != nExpected) {
+		printf("NG %d-EDO %d %s, expected %d\n", DIVISIONS, nClasses, bBracelets ? "bracelets" : "necklaces", nExpected);
+		nErrors++;
+	}
+	return !nErrors;
+}
+
+bool TestSetClassEnum()
+{
+	int	nErrors = 0;
+	// in 12-TET, bracelets must be CPitchClassSet's prime forms, with matching set IDs
+	BYTE	arrVisits[CPitchClassSet::PRIME_FORMS] = {0};
+	CSetClassEnum<12>	e(1, 12);
+	for (; !e.IsDone(); e.Next()) {
+		WORD	nMask = static_cast<WORD>(e.GetMask());
+		int	iPrime = CPitchClassSet::GetMaskClass(nMask).iPrime;
+		arrVisits[iPrime]++;
+		if (!e.IsSetIdValid() || CPitchClassSet(e.GetSetId()).GetMask() != nMask
+		|| CPitchClassSet::FindForte(CPitchClassSet(e.GetSetId()).FindPrimeForm()) != iPrime) {
+			printf("NG set ID %03x\n", nMask);
+			nErrors++;
+		}
+	}
+	for (int iPrime = 0; iPrime < CPitchClassSet::PRIME_FORMS; iPrime++) {
+		if (arrVisits[iPrime] != 1) {
+			printf("NG %s visited %d times\n", CPitchClassSet::GetForte(iPrime), arrVisits[iPrime]);
+			nErrors++;
+		}
+	}
+	// cluster-free filter must agree with brute force, and keep every harmonized set class
+	int	nClusterFree = 0;
+	for (e.Init(1, 12, true, true); !e.IsDone(); e.Next()) {
+		WORD	nMask = static_cast<WORD>(e.GetMask());
+		for (int iPC = 0; iPC < CPitchClassSet::OCTAVE; iPC++) {
+			WORD	nCluster = CPitchClassMask(0x7).Transpose(iPC).GetMask();
+			if ((nMask & nCluster) == nCluster) {
+				printf("NG cluster %03x\n", nMask);
+				nErrors++;
+			}
+		}
+		nClusterFree++;
+	}
+	for (e.Init(3, 6); !e.IsDone(); e.Next()) {	// larger sets include scales with clusters
+		WORD	nMask = static_cast<WORD>(e.GetMask());
+		int	iPrime = CPitchClassSet::GetMaskClass(nMask).iPrime;
+		if (FindAlias(iPrime) >= 0 && CSetClassEnum<12>::HasCluster(nMask)) {
+			printf("NG harmonized cluster %s\n", CPitchClassSet::GetForte(iPrime));
+			nErrors++;
+		}
+	}
+	int	nExpected = 0;
+	for (int iPrime = 0; iPrime < CPitchClassSet::PRIME_FORMS; iPrime++) {
+		WORD	nMask = CPitchClassSet::GetPrimeMask(iPrime);
+		if (nMask && !CSetClassEnum<12>::HasCluster(nMask))
+			nExpected++;
+	}
+	if (nClusterFree != nExpected) {
+		printf("NG %d cluster-free set classes, expected %d\n", nClusterFree, nExpected);
+		nErrors++;
+	}
+	if (!TestSetClassEnum<12>(true) || !TestSetClassEnum<12>(false)
+	|| !TestSetClassEnum<19>(true) || !TestSetClassEnum<22>(false) || !TestSetClassEnum<24>(true))
+		nErrors++;
+	return !nErrors;
+}
+
+bool TestFindHarmony()
+{
+	// compare with exhaustive search over transpositions and inversions
+	int	nErrors = 0;
+	for (int nMask = 1; nMask < CPitchClassSet::MASK_COUNT; nMask++) {
+		CPitchClassSet	pcs;
+		CPitchClassMask(static_cast<WORD>(nMask)).GetPitchClassSet(pcs);
+		CPitchClassSet	pcsPrime(pcs);
+		pcsPrime.MakePrimeForm();
+		int	iAliasRef = -1;
+		int	iHarmRef = 0;
+		int	nKeyShiftRef = 0;
+		int	iAlias = -1;
+		for (int iRef = 0; iRef < _countof(m_arrPCSAlias); iRef++) {
+			if (m_arrPCSAlias[iRef].iPrime == CPitchClassSet::FindForte(pcsPrime.GetId())) {
+				iAlias = iRef;
+				break;
+			}
+		}
+		if (iAlias >= 0 && m_arrPCSAlias[iAlias].arrHarm[0].nKey >= 0) {
+			CPitchClassSet	pcsTest(pcsPrime);
+			bool	bFound = false;
+			for (int iPass = 0; iPass < NUM_HARMS && !bFound; iPass++) {
+				for (int iNote = 0; iNote < NOTES && !bFound; iNote++) {
+					if (EquivalentSet(pcs, pcsTest, iNote)) {
+						bFound = true;
+						if (!iPass || m_arrPCSAlias[iAlias].arrHarm[1].nKey >= 0) {
+							iAliasRef = iAlias;
+							iHarmRef = iPass;
+							nKeyShiftRef = iNote;
+						}
+					}
+				}
+				InvertSet(pcsTest);
+			}
+		}
+		int	iHarm, nKeyShift;
+		int	iAliasTest = FindHarmony(pcs, iHarm, nKeyShift);
+		if (iAliasTest != iAliasRef || (iAliasRef >= 0 && (iHarm != iHarmRef || nKeyShift != nKeyShiftRef))) {
+			printf("NG harmony %03x\n", nMask);
+			nErrors++;
+		}
+	}
+	return !nErrors;
+}
+
+static void CountSubsetClasses(WORD nSuperMask, int *pCount)
+{
+	// brute force: classify every subset of the mask
+	ZeroMemory(pCount, CPitchClassSet::PRIME_FORMS * sizeof(int));
+	WORD	nSubMask = nSuperMask;
+	while (nSubMask) {	// for each non-empty subset
+		pCount[CPitchClassSet::GetMaskClass(nSubMask).iPrime]++;
+		nSubMask = (nSubMask - 1) & nSuperMask;
+	}
+}
+
+CSetEmbedding	m_embPrime;	// embedding numbers between all set classes
+
+bool TestSetEmbedding()
+{
+	int	nErrors = 0;
+	m_embPrime.Create();
+	int	arrCount[CPitchClassSet::PRIME_FORMS];
+	for (int iSuper = 0; iSuper < CPitchClassSet::PRIME_FORMS; iSuper++) {
+		CountSubsetClasses(CPitchClassSet::GetPrimeMask(iSuper), arrCount);
+		for (int iSub = 0; iSub < CPitchClassSet::PRIME_FORMS; iSub++) {
+			if (m_embPrime.GetEmbeddingCount(iSub, iSuper) != arrCount[iSub]) {
+				printf("NG EMB(%s, %s)\n", CPitchClassSet::GetForte(iSub), CPitchClassSet::GetForte(iSuper));
+				nErrors++;
+			}
+		}
+	}
+	for (int iScale = 0; iScale < SCALES; iScale++) {
+		const SCALE_INFO&	info = m_arrScaleInfo[iScale];
+		WORD	nScaleMask = 0;
+		for (int iTone = 0; iTone < info.nLen; iTone++)
+			nScaleMask |= 1 << info.scale.arrTone[iTone];
+		BYTE	arrEmb[CPitchClassSet::PRIME_FORMS];
+		m_embPrime.CountEmbeddings(nScaleMask, arrEmb);
+		CountSubsetClasses(nScaleMask, arrCount);
+		for (int iSub = 0; iSub < CPitchClassSet::PRIME_FORMS; iSub++) {
+			if (arrEmb[iSub] != arrCount[iSub]) {
+				printf("NG EMB(%s, %s)\n", CPitchClassSet::GetForte(iSub), info.pszName);
+				nErrors++;
+			}
+		}
+	}
+	return !nErrors;
+}
+
+bool TestSetSimilarity()
+{
+	int	nErrors = 0;
+	CSetSimilarity	simCalc;
+	simCalc.Create();
+	TCHAR	szDir[MAX_PATH], szPath[MAX_PATH];
+	if (!GetTempPath(MAX_PATH, szDir) || !GetTempFileName(szDir, _T("sim"), 0, szPath)) {
+		printf("can't get temp file name\n");
+		return false;
+	}
+	TRY {
+		simCalc.Write(szPath);
+	}
+	CATCH (CException, e) {
+		printf("can't write %s\n", szPath);
+		DeleteFile(szPath);
+		return false;
+	}
+	END_CATCH
+	CSetSimilarity	simMap;
+	if (!simMap.Map(szPath)) {
+		printf("can't map %s\n", szPath);
+		DeleteFile(szPath);
+		return false;
+	}
+	for (int iPrime1 = 0; iPrime1 < CPitchClassSet::PRIME_FORMS; iPrime1++) {
+		WORD	nMask1 = CPitchClassSet::GetPrimeMask(iPrime1);
+		CPitchClassSet::INTERVAL_VECTOR	vec1;
+		CPitchClassSet::GetIntervalVector(nMask1, vec1);
+		for (int iPrime2 = 0; iPrime2 < CPitchClassSet::PRIME_FORMS; iPrime2++) {
+			WORD	nMask2 = CPitchClassSet::GetPrimeMask(iPrime2);
+			CPitchClassSet::INTERVAL_VECTOR	vec2;
+			CPitchClassSet::GetIntervalVector(nMask2, vec2);
+			int	nDist = 0;
+			for (int iInt = 0; iInt < CPitchClassSet::INTERVALS; iInt++)
+				nDist += abs(vec1[iInt] - vec2[iInt]);
+			int	nMaxCommon = 0;
+			for (int nTranspose = 0; nTranspose < CPitchClassSet::OCTAVE; nTranspose++) {
+				WORD	nImage = CPitchClassSet::RotateMask(nMask2, nTranspose);
+				nMaxCommon = max(nMaxCommon, CPitchClassSet::CountBits(nMask1 & nImage));
+				nImage = CPitchClassSet::InvertMask(nImage);
+				nMaxCommon = max(nMaxCommon, CPitchClassSet::CountBits(nMask1 & nImage));
+			}
+			if (simCalc.GetIntervalDistance(iPrime1, iPrime2) != nDist
+			|| simMap.GetIntervalDistance(iPrime1, iPrime2) != nDist
+			|| simCalc.GetMaxCommonTones(iPrime1, iPrime2) != nMaxCommon
+			|| simMap.GetMaxCommonTones(iPrime1, iPrime2) != nMaxCommon) {
+				printf("NG %s %s\n", CPitchClassSet::GetForte(iPrime1), CPitchClassSet::GetForte(iPrime2));
+				nErrors++;
+			}
+		}
+	}
+	WORD	nMajor = 0x091, nMinor = 0x089;	// C major and C minor triads
+	if (simMap.GetMaskIntervalDistance(nMajor, nMinor) != 0 || simMap.GetMaskMaxCommonTones(nMajor, nMinor) != 3) {
+		printf("NG major minor\n");
+		nErrors++;
+	}
+	simMap.Close();	// unmap file before deleting it
+	DeleteFile(szPath);
+	return !nErrors;
+}
+
+static bool IsIncludedClass(WORD nSubMask, WORD nSuperMask)
+{
+	// true if any transposition or inversion of sub is a subset of super
+	for (int nTranspose = 0; nTranspose < CPitchClassSet::OCTAVE; nTranspose++) {
+		WORD	nImage = CPitchClassSet::RotateMask(nSubMask, nTranspose);
+		if ((nImage & nSuperMask) == nImage)
+			return true;
+		nImage = CPitchClassSet::InvertMask(nImage);
+		if ((nImage & nSuperMask) == nImage)
+			return true;
+	}
+	return false;
+}
+
+CSetComplex	m_cpxPrime;	// set complex relations between all set classes
+
+bool TestSetComplex()
+{
+	int	nErrors = 0;
+	for (int iPrime = 0; iPrime < CPitchClassSet::PRIME_FORMS; iPrime++) {
+		WORD	nCompMask = CPitchClassSet::ComplementMask(CPitchClassSet::GetPrimeMask(iPrime));
+		int	iComp = CPitchClassSet::GetComplement(iPrime);
+		if (nCompMask ? iComp != CPitchClassSet::GetMaskClass(nCompMask).iPrime : iComp >= 0) {
+			printf("NG complement %s\n", CPitchClassSet::GetForte(iPrime));
+			nErrors++;
+		}
+	}
+	if (!m_embPrime.IsCreated())
+		m_embPrime.Create();
+	m_cpxPrime.Create(m_embPrime);
+	for (int iNexus = 0; iNexus < CPitchClassSet::PRIME_FORMS; iNexus++) {
+		WORD	nN = CPitchClassSet::GetPrimeMask(iNexus);
+		WORD	nNC = CPitchClassSet::ComplementMask(nN);
+		int	nNexusSize = CPitchClassSet::CountBits(nN);
+		for (int iMember = 0; iMember < CPitchClassSet::PRIME_FORMS; iMember++) {
+			WORD	nM = CPitchClassSet::GetPrimeMask(iMember);
+			WORD	nMC = CPitchClassSet::ComplementMask(nM);
+			int	nMemberSize = CPitchClassSet::CountBits(nM);
+			int	nRel = 0;
+			if (nNexusSize >= 3 && nNexusSize <= 9 && nMemberSize >= 3 && nMemberSize <= 9
+			&& nMemberSize != nNexusSize && nMemberSize + nNexusSize != CPitchClassSet::OCTAVE) {
+				WORD	arrM[2] = {nM, nMC};
+				WORD	arrN[2] = {nN, nNC};
+				for (int iM = 0; iM < 2; iM++) {
+					int	nIncluded = 0;
+					for (int iN = 0; iN < 2; iN++) {
+						if (IsIncludedClass(arrM[iM], arrN[iN])) {
+							nRel |= CSetComplex::REL_K;
+							nIncluded++;
+						}
+						if (IsIncludedClass(arrN[iN], arrM[iM]))
+							nRel |= CSetComplex::REL_K;
+					}
+					if (nIncluded == 2)
+						nRel |= CSetComplex::REL_KH;
+				}
+			}
+			if (m_cpxPrime.GetRelation(iNexus, iMember) != nRel) {
+				printf("NG K(%s, %s)\n", CPitchClassSet::GetForte(iNexus), CPitchClassSet::GetForte(iMember));
+				nErrors++;
+			}
+		}
+	}
+	int	arrMember[CPitchClassSet::PRIME_FORMS];
+	int	iNexus = CPitchClassSet::FindForte(_T("6-Z19"));
+	int	nKh = m_cpxPrime.GetComplex(iNexus, CSetComplex::REL_KH, arrMember);
+	int	nFound = 0;
+	for (int iMember = 0; iMember < CPitchClassSet::PRIME_FORMS; iMember++) {
+		if (m_cpxPrime.GetRelation(iNexus, iMember) & CSetComplex::REL_KH) {
+			if (nFound >= nKh || arrMember[nFound] != iMember)
+				break;
+			nFound++;
+		}
+	}
+	if (!nKh || nFound != nKh) {
+		printf("NG Kh(%s)\n", CPitchClassSet::GetForte(iNexus));
+		nErrors++;
+	}
+	return !nErrors;
+}
+
+bool TestBoundArray()
+{
+	int	nErrors = 0;
+	typedef CBoundArray<int, OCTAVE> CIntArray;
+	for (int nElems = 0; nElems <= OCTAVE; nElems++) {	// sorting networks
+		for (int nBits = 0; nBits < (1 << nElems); nBits++) {	// zero-one principle
+			CIntArray	arr;
+			for (int iElem = 0; iElem < nElems; iElem++)
+				arr.Add((nBits >> iElem) & 1);
+			int	nOnes = CPitchClassSet::CountBits(static_cast<WORD>(nBits));
+			for (int iDir = 0; iDir < 2; iDir++) {
+				arr.Sort(iDir != 0);
+				for (int iElem = 0; iElem < nElems; iElem++) {
+					int	nExpected = iDir ? iElem < nOnes : iElem >= nElems - nOnes;
+					if (arr[iElem] != nExpected) {
+						printf("NG sort %d %x %d\n", nElems, nBits, iDir);
+						nErrors++;
+						break;
+					}
+				}
+			}
+		}
+	}
+	for (int iPass = 0; iPass < 10000; iPass++) {
+		int	nElems = rand() % (OCTAVE + 1);
+		CIntArray	arr;
+		vector<int>	arrRef(nElems);
+		for (int iElem = 0; iElem < nElems; iElem++) {
+			arrRef[iElem] = rand() % 16 - 8;
+			arr.Add(arrRef[iElem]);
+		}
+		std::sort(arrRef.begin(), arrRef.end());
+		arr.Sort();
+		if (arr != CIntArray(arrRef.data(), nElems)) {
+			printf("NG sort %d\n", iPass);
+			nErrors++;
+		}
+		for (int nTarget = -9; nTarget < 9; nTarget++) {
+			int	iFirst = -1, iLast = -1;
+			for (int iElem = 0; iElem < nElems; iElem++) {
+				if (arrRef[iElem] == nTarget) {
+					if (iFirst < 0)
+						iFirst = iElem;
+					iLast = iElem;
+				}
+			}
+			int	iStart = nElems ? rand() % nElems : 0;
+			int	iNext = -1;
+			for (int iElem = iStart; iElem < nElems; iElem++) {
+				if (arrRef[iElem] == nTarget) {
+					iNext = iElem;
+					break;
+				}
+			}
+			if (arr.Find(nTarget) != iFirst || arr.ReverseFind(nTarget) != iLast || arr.Find(nTarget, iStart) != iNext) {
+				printf("NG find %d %d\n", iPass, nTarget);
+				nErrors++;
+			}
+		}
+	}
+	for (int iPass = 0; iPass < 1000; iPass++) {
+		int	nElems = rand() % 97;
+		CUniqueKey	key, keyRef;
+		for (int iElem = 0; iElem < nElems; iElem++)
+			key.Add(static_cast<BYTE>(rand() % 64));
+		keyRef = key;
+		if (key != keyRef) {
+			printf("NG equal %d\n", iPass);
+			nErrors++;
+		}
+		if (nElems) {
+			int	iElem = rand() % nElems;
+			BYTE	nTarget = key[iElem];
+			if (key[key.Find(nTarget)] != nTarget || key.Find(nTarget) > iElem || key.ReverseFind(nTarget) < iElem
+			|| key.Find(nTarget, iElem) != iElem) {
+				printf("NG find %d\n", iPass);
+				nErrors++;
+			}
+			key[iElem] = static_cast<BYTE>(nTarget + 1);
+			if (key == keyRef) {
+				printf("NG unequal %d\n", iPass);
+				nErrors++;
+			}
+			key = keyRef;
+		}
+		key.Sort(true);
+		std::sort(keyRef.GetData(), keyRef.GetData() + nElems, std::greater<BYTE>());
+		if (key != keyRef) {
+			printf("NG sort key %d\n", iPass);
+			nErrors++;
+		}
+	}
+	return !nErrors;
+}
+
+// Sets used by the spacing search tests, from triads to pentads, including
+// sets that leave no pitches for spacing.
+static const CIntervalSet::SET m_arrSpacingTestSet[] = {
+	{3, 3, 3}, {4, 4, 4}, {3, 4, 5}, {2, 2, 2, 2}, {3, 4, 3, 2}, {2, 3, 2, 3}, {2, 3, 2, 3, 2}, {2, 2, 2, 2, 2},
+};
+
+template<class FUNC>
+int ForEachSpacingTestSet(FUNC func)
+{
+	// calls func(iSet, rngSet, spacings) for each spacing test set, and
+	// returns the sum of the error counts it returns
+	int	nErrors = 0;
+	for (int iSet = 0; iSet < _countof(m_arrSpacingTestSet); iSet++) {
+		CSetSpacings	spacings(m_arrSpacingTestSet[iSet]);
+		nErrors += func(iSet, m_arrSpacingTestSet[iSet], spacings);
+	}
+	return nErrors;
+}
+
+template<class FUNC>
+int ForEachSetCodeSpacing(const int *pSetCode, int nSets, FUNC func)
+{
+	// each set code's nibbles are its place ranges, first place in the least
+	// significant nibble; calls func(nSetCode, setTest, spacing) for each
+	// valid spacing of each set, and returns the sum of its error counts
+	int	nErrors = 0;
+	for (int iSet = 0; iSet < nSets; iSet++) {
+		int	nSetCode = pSetCode[iSet];
+		CIntervalSet::SET	rngSet = {0};
+		for (int iPlace = 0; iPlace < MAX_PLACES && (nSetCode >> (iPlace * 4)); iPlace++)
+			rngSet.b[iPlace] = (nSetCode >> (iPlace * 4)) & 0xf;
+		CSetSpacings	spacings(rngSet);
+		CIntervalSet	spacing;
+		for (int iSpacePerm = 0; iSpacePerm < spacings.GetCount(); iSpacePerm++) {
+			spacings.GetSpacing(iSpacePerm, spacing);
+			nErrors += func(nSetCode, spacings.m_setTest, spacing);
+		}
+	}
+	return nErrors;
+}
+
+bool TestMaskPermutation()
+{
+	static const int arrSetCode[] = {0x332, 0x2233, 0x343, 0x12121, 0x44};
+	int	nErrors = ForEachSetCodeSpacing(arrSetCode, _countof(arrSetCode), [](int nSetCode, const CIntervalSet& setTest, const CIntervalSet& spacing) -> int {
+		int	nErrors = 0;
+		CIntervalSetArray	arrPerm;
+		GetPermutations(setTest, spacing, arrPerm);
+		CMaskPermutation	perm(setTest, spacing);
+		int	nPerms = static_cast<int>(arrPerm.size());
+		if (perm.GetCount() != nPerms) {
+			printf("NG count %X\n", nSetCode);
+			nErrors++;
+		}
+		int	iPerm = 0;
+		for (; !perm.IsDone(); perm.Next(), iPerm++) {
+			WORD	nMask = CPitchClassSet(arrPerm[iPerm].GetData(), setTest.GetSize()).GetMask();
+			if (iPerm >= nPerms || perm.GetMask() != nMask) {
+				printf("NG %X %s %d\n", nSetCode, spacing.FormatSet().c_str(), iPerm);
+				nErrors++;
+				break;
+			}
+		}
+		if (iPerm != nPerms) {
+			printf("NG %X %s end %d\n", nSetCode, spacing.FormatSet().c_str(), iPerm);
+			nErrors++;
+		}
+		return nErrors;
+	});
+	return !nErrors;
+}
+
+class CMaskListFunc {	// appends each permutation's mask to a list
+public:
+	CMaskListFunc(vector<WORD>& arrMask) : m_arrMask(arrMask) {}
+	bool operator()(WORD nMask)
+	{
+		m_arrMask.push_back(nMask);
+		return true;
+	}
+	vector<WORD>&	m_arrMask;	// receives masks
+};
+
+template<int PLACES>
+void GetFixedMaskPermutations(const CIntervalSet& setTest, const CIntervalSet& spacing, vector<WORD>& arrMask)
+{
+	CFixedMaskPermutation<PLACES>	perm(setTest, spacing);
+	CMaskListFunc	func(arrMask);
+	perm.ForEach(func);
+}
+
+bool TestFixedMaskPermutation()
+{
+	static const int arrSetCode[] = {0x7, 0x66, 0x444, 0x2233, 0x12121, 0x222111, 0x1112121, 0x11111111};
+	int	nErrors = ForEachSetCodeSpacing(arrSetCode, _countof(arrSetCode), [](int nSetCode, const CIntervalSet& setTest, const CIntervalSet& spacing) -> int {
+		int	nErrors = 0;
+		int	nPlaces = setTest.GetSize();
+		vector<WORD>	arrMask;
+		switch (nPlaces) {
+		case 1: GetFixedMaskPermutations<1>(setTest, spacing, arrMask); break;
+		case 2: GetFixedMaskPermutations<2>(setTest, spacing, arrMask); break;
+		case 3: GetFixedMaskPermutations<3>(setTest, spacing, arrMask); break;
+		case 4: GetFixedMaskPermutations<4>(setTest, spacing, arrMask); break;
+		case 5: GetFixedMaskPermutations<5>(setTest, spacing, arrMask); break;
+		case 6: GetFixedMaskPermutations<6>(setTest, spacing, arrMask); break;
+		case 7: GetFixedMaskPermutations<7>(setTest, spacing, arrMask); break;
+		case 8: GetFixedMaskPermutations<8>(setTest, spacing, arrMask); break;
+		}
+		CMaskPermutation	perm(setTest, spacing);
+		int	nPerms = static_cast<int>(arrMask.size());
+		int	iPerm = 0;
+		for (; !perm.IsDone(); perm.Next(), iPerm++) {
+			if (iPerm >= nPerms || perm.GetMask() != arrMask[iPerm]) {
+				printf("NG %X %s %d\n", nSetCode, spacing.FormatSet().c_str(), iPerm);
+				nErrors++;
+				break;
+			}
+		}
+		if (iPerm != nPerms) {
+			printf("NG %X %s end %d\n", nSetCode, spacing.FormatSet().c_str(), iPerm);
+			nErrors++;
+		}
+		// dispatched kernels must agree with the general permutation
+		SPACING_SCORE	score, scoreRef = {0, 0, 0, 0};
+		ScoreSpacing(setTest, spacing, score);
+		int	nSampleTonics = 0, nSampleSubdoms = 0;
+		const CMaskScoreTable&	tblScore = CMaskScoreTable::Get();
+		for (perm.Reset(); !perm.IsDone(); perm.Next()) {
+			WORD	nMask = perm.GetMask();
+			scoreRef.nKeyHash += tblScore.m_arrKeyHash[nMask];
+			int	nHarmFunc = tblScore.m_arrHarmFunc[nMask];
+			scoreRef.nTonics += nHarmFunc == HF_TONIC;
+			scoreRef.nSubdoms += nHarmFunc == HF_SUBDOM;
+			if (scoreRef.nPerms < SPACING_SAMPLE_PERMS) {
+				nSampleTonics = scoreRef.nTonics;
+				nSampleSubdoms = scoreRef.nSubdoms;
+			}
+			scoreRef.nPerms++;
+		}
+		if (score.nTonics != scoreRef.nTonics || score.nSubdoms != scoreRef.nSubdoms
+		|| score.nPerms != scoreRef.nPerms || score.nKeyHash != scoreRef.nKeyHash) {
+			printf("NG %X %s score\n", nSetCode, spacing.FormatSet().c_str());
+			nErrors++;
+		}
+		if (GetSpacingKernel(nPlaces).pSample(setTest, spacing, 0, 1)
+		!= PackSpacingScore(nSampleTonics, nSampleSubdoms, 0, 1)) {
+			printf("NG %X %s sample\n", nSetCode, spacing.FormatSet().c_str());
+			nErrors++;
+		}
+		return nErrors;
+	});
+	return !nErrors;
+}
+
+bool TestPackedIntervalSet()
+{
+	int	nErrors = 0;
+	static const CIntervalSet::SET	arrRange[] = {{3, 4, 5}, {2, 3, 2, 3}, {4, 4, 4, 4, 4, 4, 4, 4}, {12}};
+	for (int iRange = 0; iRange < _countof(arrRange); iRange++) {
+		CIntervalSet	set;
+		set.Alloc(arrRange[iRange]);
+		CIntervalSetRange	range(set);
+		if (range.GetPermutationCount() != set.GetPermutationCount() || range.GetRangeSum() != set.GetRangeSum()) {
+			printf("NG range %d\n", iRange);
+			nErrors++;
+		}
+		CPackedIntervalSetArray	arrPacked;
+		GetPermutations(range, arrPacked);
+		int	nPerms = set.GetPermutationCount();
+		for (int iPerm = 0; iPerm < nPerms; iPerm++) {
+			set.Unpack(iPerm);
+			const CPackedIntervalSet&	packed = arrPacked[iPerm];
+			CIntervalSet	setExpanded;
+			range.Expand(packed, setExpanded);
+			if (packed != CPackedIntervalSet(set) || range.Pack(packed) != iPerm || packed.GetSum() != set.GetSum()
+			|| range.FormatSet(packed) != set.FormatSet() || !(setExpanded == set)) {
+				printf("NG %d %s\n", iRange, set.FormatSet().c_str());
+				nErrors++;
+			}
+		}
+	}
+	if (sizeof(CPackedIntervalSet) >= sizeof(CIntervalSet)) {
+		printf("NG packed %d bytes, unpacked %d bytes\n", static_cast<int>(sizeof(CPackedIntervalSet)), static_cast<int>(sizeof(CIntervalSet)));
+		nErrors++;
+	}
+	return !nErrors;
+}
+
+bool TestGetSpacings()
+{
+	int	nErrors = 0;
+	for (int nPlaces = 1; nPlaces <= 6; nPlaces++) {
+		for (int nSpaceAvail = 0; nSpaceAvail <= MAX_PITCH_COUNT - nPlaces; nSpaceAvail++) {
+			CIntervalSet::SET	rngSpacing = {0};
+			for (int iPlace = 0; iPlace < nPlaces; iPlace++)
+				rngSpacing.b[iPlace] = static_cast<uint8_t>(nSpaceAvail + 1);
+			CIntervalSetRange	range(rngSpacing);
+			CPackedIntervalSetArray	arrAll, arrSpacing;
+			GetPermutations(range, arrAll);
+			GetSpacings(nPlaces, nSpaceAvail, arrSpacing);
+			int	nAll = static_cast<int>(arrAll.size());
+			int	iSpacing = 0;
+			for (int iPerm = 0; iPerm < nAll; iPerm++) {
+				if (arrAll[iPerm].GetSum() <= nSpaceAvail) {
+					if (iSpacing >= static_cast<int>(arrSpacing.size()) || arrSpacing[iSpacing] != arrAll[iPerm]) {
+						printf("NG %d %d %s\n", nPlaces, nSpaceAvail, range.FormatSet(arrAll[iPerm]).c_str());
+						nErrors++;
+						break;
+					}
+					iSpacing++;
+				}
+			}
+			if (iSpacing != static_cast<int>(arrSpacing.size())) {
+				printf("NG %d %d count\n", nPlaces, nSpaceAvail);
+				nErrors++;
+			}
+		}
+	}
+	return !nErrors;
+}
+
+bool TestParallelFor()
 {
-	iHarm = 0;
-	nKeyShift = 0;
-	CPitchClassSet	pcsPrime(pcs);
-	pcsPrime.MakePrimeForm();
-	int	iPrime = CPitchClassSet::FindForte(pcsPrime.GetId());
-	int	iAlias = FindAlias(iPrime);
-	if (iAlias < 0 || m_arrPCSAlias[iAlias].arrHarm[0].nKey < 0)
-		return -1;
-	LPCTSTR	pszAlias = m_arrPCSAlias[iAlias].pszAlias;
-	CPitchClassSet	pcsTest(pcsPrime);
-	for (int iPass = 0; iPass < NUM_HARMS; iPass++) {
-		iHarm = iPass;
-		for (int iNote = 0; iNote < NOTES; iNote++) {
-			if (EquivalentSet(pcs, pcsTest, iNote)) {
-				if (iPass) {
-					if (m_arrPCSAlias[iAlias].arrHarm[1].nKey < 0)
-						return -1;
+	// each item must be visited exactly once, whatever the thread count,
+	// and a loop within a block must run serially rather than deadlock
+	static const int arrItems[] = {0, 1, 5, 1000, 100003};
+	static const int arrThreads[] = {1, 2, 3, 8, 0};
+	int	nErrors = 0;
+	for (int iItems = 0; iItems < _countof(arrItems); iItems++) {
+		int	nItems = arrItems[iItems];
+		for (int iThreads = 0; iThreads < _countof(arrThreads); iThreads++) {
+			vector<int>	arrVisits(nItems);
+			std::atomic<int>	nInnerVisits(0);
+			ParallelFor(nItems, 1, [&](int iStart, int iEnd) {
+				for (int iItem = iStart; iItem < iEnd; iItem++)
+					arrVisits[iItem]++;
+				ParallelFor(4, 1, [&](int iInnerStart, int iInnerEnd) {
+					nInnerVisits += iInnerEnd - iInnerStart;
+				}, arrThreads[iThreads]);
+			}, arrThreads[iThreads]);
+			for (int iItem = 0; iItem < nItems; iItem++) {
+				if (arrVisits[iItem] != 1) {
+					printf("NG items %d threads %d item %d\n", nItems, arrThreads[iThreads], iItem);
+					nErrors++;
+					break;
 				}
-				nKeyShift = iNote;
-				return iAlias;
+			}
+			if (nInnerVisits % 4 != 0 || (nItems && !nInnerVisits)) {
+				printf("NG items %d threads %d inner %d\n", nItems, arrThreads[iThreads], nInnerVisits.load());
+				nErrors++;
 			}
 		}
-		InvertSet(pcsTest);
 	}
-	return -1;
+	return !nErrors;
 }
 
-bool FindForte(const CIntervalSet& set, int& iAlias, int& iHarm, int& nKey, int& nRoot)
+bool TestParallelSpacing()
 {
-	CPitchClassSet	pcs(set.GetData(), set.GetSize());
-	int	nKeyShift;
-	iAlias = FindHarmony(pcs, iHarm, nKeyShift);
-	if (iAlias < 0)
-		return false;
-	const PCS_ALIAS& alias = m_arrPCSAlias[iAlias];
-	const HARMONIZATION& harm = alias.arrHarm[iHarm];
-	const int nTranspose = 0;
-	nKey = (harm.nKey + nKeyShift) % NOTES;
-	nRoot = (m_arrScaleInfo[harm.iScale].scale.arrTone[harm.nMode] + nKey + nTranspose) % NOTES;	
-	return true;
+	// scoring spacings on several threads must give the same results as on
+	// one; minimum work is one permutation, so even small sets are split
+	int	nErrors = ForEachSpacingTestSet([](int iSet, const CIntervalSet::SET& rngSet, const CSetSpacings&) -> int {
+		int	nErrors = 0;
+		for (int iOverride = -1; iOverride <= 2; iOverride++) {
+			for (int bSkipDups = 0; bSkipDups < 2; bSkipDups++) {
+				CIntervalSet	setSerial, setParallel;
+				SPACING_OPTIONS	opts(iOverride, bSkipDups != 0);
+				opts.nThreads = 1;
+				bool	bSerial = CalcOptimalSetSpacing(rngSet, setSerial, opts);
+				opts.nThreads = 4;
+				opts.nMinWork = 1;
+				bool	bParallel = CalcOptimalSetSpacing(rngSet, setParallel, opts);
+				if (bSerial != bParallel || setSerial.GetSize() != setParallel.GetSize()
+				|| (bSerial && CPackedIntervalSet(setSerial) != CPackedIntervalSet(setParallel))) {
+					printf("NG set %d override %d skip %d\n", iSet, iOverride, bSkipDups);
+					nErrors++;
+				}
+			}
+		}
+		return nErrors;
+	});
+	return !nErrors;
 }
 
-bool ForteReport(const CIntervalSet& set)
+bool TestDuplicateSpacings()
 {
-	int iAlias, iHarm, nKey, nRoot;
-	if (FindForte(set, iAlias, iHarm, nKey, nRoot)) {
-		LPCTSTR	pszChordType;
-		const PCS_ALIAS& alias = m_arrPCSAlias[iAlias];
-		const HARMONIZATION& harm = alias.arrHarm[iHarm];
-		if (harm.pszName != NULL)
-			pszChordType = harm.pszName;
-		else
-			pszChordType = alias.pszAlias;
-		CString	sChordName;
-		sChordName = m_arrNoteName[nRoot];
-		sChordName += pszChordType;
-		printf("%s\t%s\t%s\t%s\t%s\n", CPitchClassSet::GetForte(alias.iPrime), sChordName.GetString(), m_arrNoteName[nKey],
-			m_arrScaleInfo[harm.iScale].pszName, m_arrModeName[harm.nMode]);
-	} else {
-		printf("%s NOT FOUND\n", set.FormatSet().c_str());
-		return false;
-	}
-	return true;
+	// duplicate counts must match a search of sorted keys
+	int	nErrors = ForEachSpacingTestSet([](int iSet, const CIntervalSet::SET& rngSet, const CSetSpacings& spacings) -> int {
+		int	nErrors = 0;
+		vector<CUniqueKey>	arrUniqueKey;
+		vector<int>	arrRefCount;
+		for (int iSpacePerm = 0; iSpacePerm < spacings.GetCount(); iSpacePerm++) {
+			CIntervalSet	spacing;
+			spacings.GetSpacing(iSpacePerm, spacing);
+			CUniqueKey	key;
+			for (CMaskPermutation perm(spacings.m_setTest, spacing); !perm.IsDone(); perm.Next())
+				key.Add(CPitchClassSet::GetMaskClass(perm.GetMask()).iPrime);
+			key.Sort();
+			vector<CUniqueKey>::iterator it = find(arrUniqueKey.begin(), arrUniqueKey.end(), key);
+			if (it != arrUniqueKey.end()) {
+				arrRefCount[it - arrUniqueKey.begin()]++;
+			} else {
+				arrUniqueKey.push_back(key);
+				arrRefCount.push_back(1);
+			}
+		}
+		CIntervalSet	setBest;
+		vector<int>	arrDupCount;
+		SPACING_OPTIONS	opts(-1, true);
+		opts.parrDupCount = &arrDupCount;
+		CalcOptimalSetSpacing(rngSet, setBest, opts);
+		if (arrDupCount != arrRefCount) {
+			printf("NG set %d: %d classes, expected %d\n", iSet, static_cast<int>(arrDupCount.size()), static_cast<int>(arrRefCount.size()));
+			nErrors++;
+		}
+		opts.bSkipDups = false;
+		CalcOptimalSetSpacing(rngSet, setBest, opts);
+		if (arrDupCount != vector<int>(spacings.GetCount(), 1)) {
+			printf("NG set %d without skipping\n", iSet);
+			nErrors++;
+		}
+		return nErrors;
+	});
+	return !nErrors;
 }
 
-bool ForteReport(const CIntervalSetArray& arrPerm)
+bool TestMaskScoreTable()
 {
-	int	nPerms = static_cast<int>(arrPerm.size());
-	for (int iPerm = 0; iPerm < nPerms; iPerm++) {
-		if (!ForteReport(arrPerm[iPerm]))
-			return false;
+	// compare with classifying each mask via its prime form and alias
+	int	nErrors = 0;
+	const CMaskScoreTable&	tblScore = CMaskScoreTable::Get();
+	for (int nMask = 1; nMask < CPitchClassSet::MASK_COUNT; nMask++) {
+		CPitchClassSet	pcs;
+		CPitchClassMask(static_cast<WORD>(nMask)).GetPitchClassSet(pcs);
+		pcs.MakePrimeForm();
+		int	iPrime = CPitchClassSet::FindForte(pcs.GetId());
+		int	iAlias = FindAlias(iPrime);
+		int	iHarmFunc = iAlias >= 0 ? m_arrPCSAlias[iAlias].iHarmFunc : -1;
+		if (tblScore.m_arrHarmFunc[nMask] != iHarmFunc
+		|| tblScore.m_arrKeyHash[nMask] != tblScore.m_arrPrimeHash[iPrime]) {
+			printf("NG %03x\n", nMask);
+			nErrors++;
+		}
 	}
-	return true;
+	return !nErrors;
 }
 
-typedef CBoundArray<BYTE, 96> CUniqueKey;
-
-bool CalcOptimalSetSpacing(const CIntervalSet::SET& rngTest, CIntervalSet& m_setBestSpacing, int iOverride = -1, bool bSkipDups = false)
+bool TestPrunedSpacing()
 {
-	CIntervalSet	setTest;
-	setTest.Alloc(rngTest);
-	CIntervalSetArray	arrSet;
-	int	nRangeSum = setTest.GetRangeSum();
-	int	nSpaceAvail = MAX_PITCH_COUNT - nRangeSum;
-	CIntervalSet::SET	rngInit;
-	rngInit.dw = 0;
-	for (int iPlace = 0; iPlace < setTest.GetSize(); iPlace++) {
-		rngInit.b[iPlace] = nSpaceAvail + 1;
-	}
-	CIntervalSet	range;
-	range.Alloc(rngInit);
-	CIntervalSetArray	arrSpacingPerm;
-	GetPermutations(range, arrSpacingPerm);
-	int	nSpacePerms = static_cast<int>(arrSpacingPerm.size());
-	int	nMostTonics = 0;
-	int	nMostSubdoms = 0;
-	CIntervalSetArray	arrMostConsonant;
-	CIntervalSet	setBestSpacing;
-	int	nValidSpacePerms = 0;
-	int	nKnownBest = 5;
-	vector<CUniqueKey>	arrUniqueKey;
-	if (CONSOLE_NATTER) {
-		printf("iOverride = %d, bSkipDups = %d\n", iOverride, bSkipDups);
-		printf("index\tscore\tspacing\n");
-	}
-	bool	bOverrideFound = false;
-	for (int iSpacePerm = 0; iSpacePerm < nSpacePerms; iSpacePerm++) {
-		CIntervalSet&	spacing = arrSpacingPerm[iSpacePerm];
-		int	nSpacingSum = spacing.GetSum();
-		if (nRangeSum + nSpacingSum <= MAX_PITCH_COUNT) {
-			CIntervalSetArray	arrPerm;
-			GetPermutations(setTest, spacing, arrPerm);
-			int	nPerms = static_cast<int>(arrPerm.size());
-			int	nTonics = 0;
-			int	nSubdoms = 0;
-			CUniqueKey	arrPrimeIdx;
-			for (int iPerm = 0; iPerm < nPerms; iPerm++) {
-				CPitchClassSet	pcs(arrPerm[iPerm].GetData(), setTest.GetSize());
-				CPitchClassSet	pcsPrime(pcs);
-				pcsPrime.MakePrimeForm();
-				int	iPrime = CPitchClassSet::FindForte(pcsPrime.GetId());
-				ASSERT(iPrime >= 0 && iPrime <= BYTE_MAX);
-				arrPrimeIdx.Add(iPrime);
-				int	iAlias = FindAlias(iPrime);
-				ASSERT(iAlias >= 0);
-				switch (m_arrPCSAlias[iAlias].iHarmFunc) {
-				case HF_TONIC:
-					nTonics++;
-					break;
-				case HF_SUBDOM:
-					nSubdoms++;
-					break;
+	// branch and bound must find the same spacing as exhaustive search
+	int	nErrors = ForEachSpacingTestSet([](int iSet, const CIntervalSet::SET& rngSet, const CSetSpacings&) -> int {
+		int	nErrors = 0;
+		for (int bSkipDups = 0; bSkipDups < 2; bSkipDups++) {
+			CIntervalSet	setRef;
+			SPACING_OPTIONS	opts(-1, bSkipDups != 0);
+			bool	bRef = CalcOptimalSetSpacing(rngSet, setRef, opts);
+			opts.bPrune = true;
+			opts.nMinWork = 1;	// so that even small sets are split
+			for (int nThreads = 1; nThreads <= 4; nThreads += 3) {	// serial, then several threads
+				CIntervalSet	setPruned;
+				opts.nThreads = nThreads;
+				bool	bPruned = CalcOptimalSetSpacing(rngSet, setPruned, opts);
+				if (bPruned != bRef || setPruned.GetSize() != setRef.GetSize()
+				|| (bRef && CPackedIntervalSet(setPruned) != CPackedIntervalSet(setRef))) {
+					printf("NG set %d skip %d threads %d\n", iSet, bSkipDups, nThreads);
+					nErrors++;
 				}
 			}
-			// two permutations collide if they generate the same key (sorted list of prime form indices)
-			if (bSkipDups) {	// if skipping duplicates
-				arrPrimeIdx.Sort();	// sort prime indices to produce stable key
-				vector<CUniqueKey>::iterator it;
-				it = find(arrUniqueKey.begin(), arrUniqueKey.end(), arrPrimeIdx);
-				if (it != arrUniqueKey.end()) {	// if key was previously encountered
-					continue;	// collision; skip duplicate
-				}
-				arrUniqueKey.push_back(arrPrimeIdx);
-			}
-//			spacing.Dump();
-			if (CONSOLE_NATTER) {
-				printf("%d\t%d, %d\t", nValidSpacePerms, nTonics, nSubdoms);
-				spacing.Dump();
-			}
-//			arrPerm[0].Dump();
-/*			if (nConsonant == nKnownBest) {
-				ForteReport(arrPerm);
-			}*/
-			if (nValidSpacePerms == iOverride)
-				bOverrideFound = true;
-			if (nTonics > nMostTonics || (nTonics == nMostTonics && nSubdoms > nMostSubdoms) || bOverrideFound) {
-				nMostTonics = nTonics;
-				nMostSubdoms = nSubdoms;
-				arrMostConsonant = arrPerm;
-				setBestSpacing = spacing;
-			}
-			nValidSpacePerms++;
-			if (bOverrideFound)
-				break;
-		}
-	}
-	if (bOverrideFound) {
-		if (CONSOLE_NATTER) {
-			printf("override: using permutation %d\n", iOverride);
-		}
-	} else {
-		if (iOverride >= nValidSpacePerms) {
-			printf("override index is out of range\n");
-			return false;
 		}
-		if (CONSOLE_NATTER) {
-			printf("permutations = %d\n", nValidSpacePerms);
-		}
-	}
-	if (setBestSpacing.GetSize()) {
-		int	nPerms = static_cast<int>(arrMostConsonant.size());
-		if (CONSOLE_NATTER) {
-			printf("best:\t%d, %d (%.0f%%, %.0f%%)\t", nMostTonics, nMostSubdoms,
-				double(nMostTonics) / nPerms * 100, double(nMostSubdoms) / nPerms * 100);
-			setBestSpacing.Dump();
-//			ForteReport(arrMostConsonant);
-		}
-/*		for (int iPerm = 0; iPerm < nPerms; iPerm++) {
-			arrMostConsonant[iPerm].Dump();
-		}*/
-		m_setBestSpacing = setBestSpacing;
-		return true;
-	}
-	return false;
+		return nErrors;
+	});
+	return !nErrors;
 }
 
-static const int m_arrIntervalSetCode[] = {
-#define INTERVAL_SET(code) {0x##code},
-#include "IntervalSetsList.h"
-};
-
-void CalcOptimalSpacingAllSets()
+bool TestSpacingClasses()
 {
-	for (int iSet = 0; iSet < _countof(m_arrIntervalSetCode); iSet++) {
-		int	nSetCode = m_arrIntervalSetCode[iSet];
-		CIntervalSet::SET	setSpan = {0};
-		int iPlace;
-		for (iPlace = 0; iPlace < MAX_PLACES; iPlace++) {
-			 int	nDigit = (nSetCode >> (iPlace * 4)) & 0xf;
-			 if (!nDigit)
-				 break;
-			 setSpan.b[iPlace] = nDigit;
-		}
-		// can't do hexachord due to missing harmonization for 6-20
-		if (iPlace >= 3 && iPlace <= 5) {	// if acceptable chord size
-			printf("{%X}\n", nSetCode);
-			CIntervalSet	setResult;
-			CalcOptimalSetSpacing(setSpan, setResult);
+	// spacings in the same symmetry class must have the same score and key
+	int	nErrors = ForEachSpacingTestSet([](int iSet, const CIntervalSet::SET&, const CSetSpacings& spacings) -> int {
+		int	nErrors = 0;
+		const CIntervalSet&	setTest = spacings.m_setTest;
+		vector<int>	arrClassRep;
+		FindSpacingClasses(setTest, spacings.m_arrSpacing, arrClassRep);
+		for (int iSpacePerm = 0; iSpacePerm < spacings.GetCount(); iSpacePerm++) {
+			int	iRep = arrClassRep[iSpacePerm];
+			if (iRep == iSpacePerm)
+				continue;
+			CIntervalSet	spacing, spacingRep;
+			spacings.GetSpacing(iSpacePerm, spacing);
+			spacings.GetSpacing(iRep, spacingRep);
+			SPACING_SCORE	score, scoreRep;
+			ScoreSpacing(setTest, spacing, score);
+			ScoreSpacing(setTest, spacingRep, scoreRep);
+			if (iRep > iSpacePerm || score.nTonics != scoreRep.nTonics || score.nSubdoms != scoreRep.nSubdoms
+			|| score.nKeyHash != scoreRep.nKeyHash || CPrimeHistogram(setTest, spacing) != CPrimeHistogram(setTest, spacingRep)) {
+				printf("NG set %d spacing %d\n", iSet, iSpacePerm);
+				nErrors++;
+			}
 		}
-	}
+		return nErrors;
+	});
+	return !nErrors;
 }
 
-bool TestHarmonizations()
+bool TestSpacingRanking()
 {
-	int	nErrors = 0;
-	for (int iAlias = 0; iAlias < _countof(m_arrPCSAlias); iAlias++) {
-		const PCS_ALIAS	pcs = m_arrPCSAlias[iAlias];
-		CPitchClassSet	setRef(CPitchClassSet::GetPrimeId(pcs.iPrime));
-		for (int iHarm = 0; iHarm < NUM_HARMS; iHarm++) {
-			const HARMONIZATION& harm = pcs.arrHarm[iHarm];
-			if (harm.nKey >= 0) {
-				CBoundArray<int, OCTAVE> arrChordTone;
-				int	nChordTones = setRef.GetSize();
-				arrChordTone.SetSize(nChordTones);
-				const SCALE_INFO&	info = m_arrScaleInfo[harm.iScale];
-				int	nScaleLen = info.nLen;
-				for (int iTone = 0; iTone < nChordTones; iTone++) {
-					int	iScaleTone = (harm.arrTone[iTone] - 1 + harm.nMode) % nScaleLen;
-					arrChordTone[iTone] = (info.scale.arrTone[iScaleTone] + harm.nKey) % NOTES;
-				}
-				arrChordTone.Sort();
-				CPitchClassSet	setTest(arrChordTone.GetData(), nChordTones);
-				bool	bFound;
-				if (!iHarm) {
-					bFound = (setTest == setRef);
-				} else {
-					InvertSet(setRef);
-					bFound = EquivalentSet(setRef, setTest);
-				}
-				if (!bFound) {
-					printf("NG %s %s\n", CPitchClassSet::GetForte(pcs.iPrime), setRef.FormatSet().c_str());
-					for (int iTone = 0; iTone < nChordTones; iTone++) {
-						printf("%d ", arrChordTone[iTone]);
-					}
-					printf("\n");
+	// each ranked spacing must be what its override selects, and the best must come first
+	int	nErrors = ForEachSpacingTestSet([](int iSet, const CIntervalSet::SET& rngSet, const CSetSpacings& spacings) -> int {
+		int	nErrors = 0;
+		for (int bSkipDups = 0; bSkipDups < 2; bSkipDups++) {
+			CIntervalSet	setBest, setRanked;
+			vector<int>	arrDupCount;
+			CSpacingRanking	ranking(5);
+			bool	bBest = CalcOptimalSetSpacing(rngSet, setBest, SPACING_OPTIONS(-1, bSkipDups != 0));
+			SPACING_OPTIONS	opts(1, bSkipDups != 0);
+			opts.parrDupCount = &arrDupCount;
+			opts.pRanking = &ranking;
+			CalcOptimalSetSpacing(rngSet, setRanked, opts);
+			int	nTop = ranking.GetTopCount();
+			int	nTotal = 0;
+			for (int nTonics = 0; nTonics <= ranking.GetPermCount(); nTonics++) {
+				for (int nSubdoms = 0; nSubdoms <= ranking.GetPermCount(); nSubdoms++)
+					nTotal += ranking.GetHistogram(nTonics, nSubdoms);
+			}
+			if (nTotal != ranking.GetValidCount() || nTotal != static_cast<int>(arrDupCount.size())
+			|| nTop != min(5, nTotal)) {
+				printf("NG set %d skip %d counts\n", iSet, bSkipDups);
+				nErrors++;
+			}
+			for (int iTop = 0; iTop < nTop; iTop++) {
+				const RANKED_SPACING&	top = ranking.GetTop(iTop);
+				CIntervalSet	setSpacing, setOverride;
+				spacings.GetSpacing(top.iSpacing, setSpacing);
+				if (!CalcOptimalSetSpacing(rngSet, setOverride, SPACING_OPTIONS(top.iValid, bSkipDups != 0))
+				|| CPackedIntervalSet(setOverride) != CPackedIntervalSet(setSpacing)
+				|| (iTop && (top.nTonics > ranking.GetTop(iTop - 1).nTonics
+				|| (top.nTonics == ranking.GetTop(iTop - 1).nTonics && top.nSubdoms > ranking.GetTop(iTop - 1).nSubdoms)))
+				|| (!iTop && bBest && CPackedIntervalSet(setBest) != CPackedIntervalSet(setSpacing))) {
+					printf("NG set %d skip %d rank %d\n", iSet, bSkipDups, iTop);
 					nErrors++;
 				}
 			}
 		}
+		return nErrors;
+	});
+	return !nErrors;
+}
+
+bool TestParseProgression()
+{
+	int	nErrors = 0;
+	for (int iPrime = 0; iPrime < CPitchClassSet::PRIME_FORMS; iPrime++) {
+		LPCTSTR	pszForte = CPitchClassSet::GetForte(iPrime);
+		int	nLen = static_cast<int>(_tcslen(pszForte));
+		bool	bInverse;
+		if (CPitchClassSet::FindForte(pszForte) != iPrime
+		|| CPitchClassSet::FindForte(pszForte, nLen, bInverse) != iPrime || bInverse) {
+			printf("NG Forte %s\n", pszForte);
+			nErrors++;
+		}
+	}
+	if (m_idxChordSymbol.IsEmpty())
+		InitChordSymbols();
+	for (int iSym = 0; iSym < m_arrChordSymbol.GetSize(); iSym++) {
+		const CHORD_SYMBOL&	sym = m_arrChordSymbol[iSym];
+		const PCS_ALIAS&	alias = m_arrPCSAlias[sym.iAlias];
+		if (CPitchClassSet::GetMaskClass(sym.nMask).iPrime != alias.iPrime) {	// if chord isn't in alias's set class
+			printf("NG symbol %d %s\n", iSym, CPitchClassSet::GetForte(alias.iPrime));
+			nErrors++;
+		}
+	}
+	static const struct {
+		LPCTSTR	pszText;
+		WORD	nMask;
+	} arrCase[] = {
+		{_T("C"),			0x091},	// C E G
+		{_T("Bb-7b5"),		0x512},	// Bb Db E Ab
+		{_T("G7"),			0x8a4},	// G B D F
+		{_T("Dmaj7#4"),		0x154},	// D E F# G#
+		{_T("C-7/F"),		0x4a9},	// C Eb G Bb F
+		{_T("C/E"),			0x091},	// C E G
+		{_T("Bb/D"),		0x424},	// Bb D F
+		{_T("F#dim"),		0x241},	// F# A C
+		{_T("3-11b"),		0x221},	// C F A
+		{_T("4-z15"),		0x053},	// 0 1 4 6
+		{_T("4-15"),		0x053},
+	};
+	for (int iCase = 0; iCase < _countof(arrCase); iCase++) {
+		CWordArray	arrMask;
+		if (!ParseProgression(arrCase[iCase].pszText, arrMask)
+		|| arrMask.GetSize() != 1 || arrMask[0] != arrCase[iCase].nMask) {
+			printf("NG parse %s\n", arrCase[iCase].pszText);
+			nErrors++;
+		}
+	}
+	CWordArray	arrMask;
+	if (!ParseProgression(_T("| Eb-7 Ab7 | Dbmaj7 % | 4-27B, C7/E |"), arrMask) || arrMask.GetSize() != 6) {
+		printf("NG parse progression\n");
+		nErrors++;
 	}
 	return !nErrors;
 }
@@ -637,6 +2897,19 @@ bool ValidateSetClasses(LPCTSTR pszCSVInPath)
 	// input file is Wikipedia's List_of_set_classes page converted to CSV format via convertcsv.com
 	// NOTE: Wikipedia and CPitchClassSet both use Rahn's packing, hence a perfect match is expected
 	CStdioFile	fIn(pszCSVInPath, CFile::modeRead);
+	// enumerate set classes under transposition only; each one that doesn't
+	// contain its prime form is the inversion of an asymmetric prime form
+	typedef CSetClassEnum<CPitchClassSet::OCTAVE> CEnum;
+	vector<WORD>	arrInverseMask(CPitchClassSet::PRIME_FORMS);	// canonical mask of each prime form's inversion, or zero if symmetric
+	int	nAsymmetric = 0;
+	for (CEnum e(1, CPitchClassSet::OCTAVE, false); !e.IsDone(); e.Next()) {
+		WORD	nMask = static_cast<WORD>(e.GetMask());
+		int	iPrime = CPitchClassSet::GetMaskClass(nMask).iPrime;
+		if (nMask != CEnum::EDO::Canonicalize(CPitchClassSet::GetPrimeMask(iPrime))) {	// if inversion
+			arrInverseMask[iPrime] = nMask;
+			nAsymmetric++;
+		}
+	}
 	CString	sLine;
 	int	nPrimes = 0;
 	int	nInversions = 0;
@@ -678,13 +2951,13 @@ bool ValidateSetClasses(LPCTSTR pszCSVInPath)
 							return false;
 						}
 						CPitchClassSet	setCK(CPitchClassSet::GetPrimeId(iPrime));
+						bool	bMismatch;
 						if (bIsInversion) {	// if inversion
-							CPitchClassSet	setTemp(setCK);
-							CPitchClassSet::SET_ID	idInverse;
-							CPitchClassSet::SET_ID	id = setTemp.FindPrimeForm(&idInverse);
-							setCK = CPitchClassSet(idInverse);	// replace prime form with its inversion
-						}
-						if (setCK != setWP) {	// if our set doesn't match Wikipedia reference
+							// the inversion's packing differs from ours, so compare transposition classes
+							bMismatch = !arrInverseMask[iPrime] || CEnum::EDO::Canonicalize(setWP.GetMask()) != arrInverseMask[iPrime];
+						} else	// prime form
+							bMismatch = setCK != setWP;
+						if (bMismatch) {	// if our set doesn't match Wikipedia reference
 							printf("mismatch in set %s\n", sName.GetString());
 							setWP.Dump();
 							setCK.Dump();
@@ -699,6 +2972,10 @@ bool ValidateSetClasses(LPCTSTR pszCSVInPath)
 		printf("wrong number of prime forms\n");
 		return false;
 	}
+	if (nInversions != nAsymmetric) {
+		printf("wrong number of inversions\n");
+		return false;
+	}
 	printf("nPrimes = %d, nInversions = %d\n", nPrimes, nInversions);
 	return true;
 }
@@ -1308,7 +3585,9 @@ bool ProcessIntervalSet(UINT nSetCode)
 	}
 	int	iSpacingOverride = -1;	// if non-negative, index of spacing to select, regardless of optimality
 	bool	bSkipDups = 0;	// non-zero to exclude duplicate spacing permutations (based on prime forms they produce)
-	if (!CalcOptimalSetSpacing(m_setSpan, m_setBestSpacing, iSpacingOverride, bSkipDups))
+	SPACING_OPTIONS	opts(iSpacingOverride, bSkipDups != 0);
+	opts.bPrune = true;
+	if (!CalcOptimalSetSpacing(m_setSpan, m_setBestSpacing, opts))
 		return false;
 #else	// special case for chord progression as pitch class sets in CSV format
 //	LPCTSTR pszPCSPath = _T("C:\\Chris\\MyProjects\\MidiFilter\\MidiFilter\\534 PCS.txt");
@@ -1733,7 +4012,12 @@ public:
 	int		m_nHexSet;
 	CIntervalSet::SET	m_arrSet;
 	CStdioFile	m_fOut;
+	void	Init(int nSet);
 	void	CrawlCommonTones(int iDepth);
+	int		CountCommonTones();
+	uint64_t	GetLeafCount() const;
+	uint64_t	GetLeafIndex() const;
+	bool	SetLeaf(uint64_t iLeaf);
 };
 
 CCommonToneCrawler::CCommonToneCrawler()
@@ -1758,26 +4042,12 @@ void CCommonToneCrawler::CrawlCommonTones(int iDepth)
 			CrawlCommonTones(iDepth + 1);
 			continue;
 		}
-		if (!ProcessIntervalSet(m_nHexSet)) {
+		int	nCommon = CountCommonTones();
+		if (nCommon < 0) {
 			printf("ERROR!\n"); 
 			return;
 		}
-		MakeScalesAndChords();
-		int	nPerms = static_cast<int>(m_arrChord.GetSize());
-		int	nCommon = 0;
-		for (int iPerm = 0; iPerm < nPerms; iPerm++) {
-			const CChord&	chord = m_arrChord[iPerm];
-			int	iNext = iPerm + 1;
-			if (iNext >= nPerms)
-				iNext = 0;
-			const CChord&	chordNext = m_arrChord[iNext];
-			int	nTones = chord.m_ScaleTone.nLen;
-			for (int iTone = 0; iTone < nTones; iTone++) {
-				if (Find(chord.m_ScaleTone.scale.arrTone[iTone], chordNext.m_ScaleTone.scale.arrTone, nTones) >= 0) {
-					nCommon++;
-				}
-			}
-		}
+		ASSERT(GetLeafIndex() == static_cast<uint64_t>(m_nCommonPerms));
 		if (nCommon < m_nMinCommon) {
 			m_nMinCommon = nCommon;
 		}
@@ -1804,27 +4074,91 @@ void CCommonToneCrawler::CrawlCommonTones(int iDepth)
 	}
 }
 
-void AnalyzeCommonTones(int nSet)
+int CCommonToneCrawler::CountCommonTones()
 {
-	CCommonToneCrawler	ctc;
-	ctc.m_arrSet.dw = 0;	// convert hexadecimal set code to interval set
-	ctc.m_nHexSet = nSet;
+	// process interval set using current tone map; returns number of
+	// common tones between successive chords, or -1 on error
+	if (!ProcessIntervalSet(m_nHexSet))
+		return -1;
+	MakeScalesAndChords();
+	int	nPerms = static_cast<int>(m_arrChord.GetSize());
+	int	nCommon = 0;
+	for (int iPerm = 0; iPerm < nPerms; iPerm++) {
+		const CChord&	chord = m_arrChord[iPerm];
+		int	iNext = iPerm + 1;
+		if (iNext >= nPerms)
+			iNext = 0;
+		const CChord&	chordNext = m_arrChord[iNext];
+		int	nTones = chord.m_ScaleTone.nLen;
+		for (int iTone = 0; iTone < nTones; iTone++) {
+			if (Find(chord.m_ScaleTone.scale.arrTone[iTone], chordNext.m_ScaleTone.scale.arrTone, nTones) >= 0) {
+				nCommon++;
+			}
+		}
+	}
+	return nCommon;
+}
+
+// A leaf's index is the number of leaves the crawler visits before it. The
+// crawler's first digit varies slowest, so the index is a mixed-radix number
+// whose most significant digit is the rank of the first digit's tone map,
+// and whose radices are the numbers of tone maps for each digit.
+
+uint64_t CCommonToneCrawler::GetLeafCount() const
+{
+	uint64_t	nLeaves = 1;
+	for (int iDigit = 0; iDigit < m_nDigits; iDigit++)
+		nLeaves *= Factorial(m_arrSet.b[iDigit]);
+	return nLeaves;
+}
+
+uint64_t CCommonToneCrawler::GetLeafIndex() const
+{
+	// returns index of leaf corresponding to current tone map
+	uint64_t	iLeaf = 0;
+	for (int iDigit = 0; iDigit < m_nDigits; iDigit++) {
+		int	nSpan = m_arrSet.b[iDigit];
+		iLeaf = iLeaf * Factorial(nSpan) + gen_perm_rep_lex_rank(m_arrToneMap[iDigit], static_cast<unsigned char>(nSpan));
+	}
+	return iLeaf;
+}
+
+bool CCommonToneCrawler::SetLeaf(uint64_t iLeaf)
+{
+	// sets tone map to that of the given leaf, without crawling
+	if (iLeaf >= GetLeafCount())
+		return false;
+	for (int iDigit = m_nDigits - 1; iDigit >= 0; iDigit--) {
+		int	nSpan = m_arrSet.b[iDigit];
+		int	nPerms = Factorial(nSpan);
+		for (int iVal = 0; iVal < nSpan; iVal++)
+			m_arrToneMap[iDigit][iVal] = static_cast<BYTE>(iVal);
+		gen_perm_rep_lex_unrank(m_arrToneMap[iDigit], static_cast<unsigned char>(nSpan), iLeaf % nPerms);
+		iLeaf /= nPerms;
+	}
+	m_bMapTones = true;
+	return true;
+}
+
+void CCommonToneCrawler::Init(int nSet)
+{
+	m_arrSet.dw = 0;	// convert hexadecimal set code to interval set
+	m_nHexSet = nSet;
 	int	nPlaces = 0;
 	for (int iPlace = MAX_PLACES - 1; iPlace >= 0; iPlace--) {
 		int	nRadix = (nSet >> (iPlace * 4)) & 0xf;
 		if (nRadix) {
-			ctc.m_arrSet.b[nPlaces] = nRadix;
+			m_arrSet.b[nPlaces] = nRadix;
 			nPlaces++;
 		}
 	}
-	ctc.m_fOut.Open("AnalCommonTone.txt", CFile::modeCreate | CFile::modeWrite);
-	ctc.m_arrCTPerm.SetSize(nPlaces);
-	ctc.m_nDigits = nPlaces;
+	m_arrCTPerm.SetSize(nPlaces);
+	m_nDigits = nPlaces;
 	CByteArray	arrTemp;
 	for (int iPlace = 0; iPlace < nPlaces; iPlace++) {
-		int	nSpan = ctc.m_arrSet.b[iPlace];
+		int	nSpan = m_arrSet.b[iPlace];
 		int	nPerms = Factorial(nSpan);
-		ctc.m_arrCTPerm[iPlace].SetSize(nPerms);
+		m_arrCTPerm[iPlace].SetSize(nPerms);
 		arrTemp.SetSize(nSpan);
 		for (int iVal = 0; iVal < nSpan; iVal++) {
 			arrTemp[iVal] = iVal;
@@ -1833,12 +4167,19 @@ void AnalyzeCommonTones(int nSet)
 		int	iPerm = 0;
 		while (gen_result == GEN_NEXT) {
 			for (int iVal = 0; iVal < nSpan; iVal++) {
-				ctc.m_arrCTPerm[iPlace][iPerm].b[iVal] = arrTemp[iVal];
+				m_arrCTPerm[iPlace][iPerm].b[iVal] = arrTemp[iVal];
 			}
 			gen_result = gen_perm_rep_lex_next(arrTemp.GetData(), nSpan);
 			iPerm++;
 		}
 	}
+}
+
+void AnalyzeCommonTones(int nSet)
+{
+	CCommonToneCrawler	ctc;
+	ctc.Init(nSet);
+	ctc.m_fOut.Open("AnalCommonTone.txt", CFile::modeCreate | CFile::modeWrite);
 	m_bMapTones = true;
 	ctc.CrawlCommonTones(0);
 	CString	s;
@@ -1846,14 +4187,136 @@ void AnalyzeCommonTones(int nSet)
 	ctc.m_fOut.WriteString(s);
 }
 
+int AnalyzeCommonToneLeaf(int nSet, uint64_t iLeaf)
+{
+	// reproduce a single result of AnalyzeCommonTones, given its index;
+	// returns number of common tones, or -1 on error
+	CCommonToneCrawler	ctc;
+	ctc.Init(nSet);
+	if (!ctc.SetLeaf(iLeaf))
+		return -1;
+	return ctc.CountCommonTones();
+}
+
+bool TestRanking()
+{
+	int	nErrors = 0;
+	for (int nPlaces = 1; nPlaces <= 6; nPlaces++) {	// spacings
+		for (int nSpaceAvail = 0; nSpaceAvail <= MAX_PITCH_COUNT - nPlaces; nSpaceAvail++) {
+			CPackedIntervalSetArray	arrSpacing;
+			GetSpacings(nPlaces, nSpaceAvail, arrSpacing);
+			int	nSpacings = static_cast<int>(arrSpacing.size());
+			if (gen_comp_weak_colex_count(static_cast<unsigned char>(nSpaceAvail), static_cast<unsigned char>(nPlaces)) != static_cast<unsigned>(nSpacings)) {
+				printf("NG spacing count %d %d\n", nPlaces, nSpaceAvail);
+				nErrors++;
+			}
+			for (int iSpacing = 0; iSpacing < nSpacings; iSpacing++) {
+				CPackedIntervalSet	spacing;
+				if (GetSpacingIndex(nPlaces, nSpaceAvail, arrSpacing[iSpacing]) != iSpacing
+				|| !GetSpacing(nPlaces, nSpaceAvail, iSpacing, spacing) || spacing != arrSpacing[iSpacing]) {
+					printf("NG spacing %d %d %d\n", nPlaces, nSpaceAvail, iSpacing);
+					nErrors++;
+				}
+			}
+			CPackedIntervalSet	spacing;
+			if (GetSpacing(nPlaces, nSpaceAvail, nSpacings, spacing)) {
+				printf("NG spacing range %d %d\n", nPlaces, nSpaceAvail);
+				nErrors++;
+			}
+		}
+	}
+	static const char	*arrMultiset[] = {"\0\1\2\3", "\0\0\1\2\2", "\0\1\1\1\3\3\4", "\5"};
+	static const int	arrMultisetLen[] = {4, 5, 7, 1};
+	for (int iSet = 0; iSet < _countof(arrMultiset); iSet++) {	// permutations
+		unsigned char	n = static_cast<unsigned char>(arrMultisetLen[iSet]);
+		unsigned char	arrPerm[MAX_PITCH_COUNT], arrJump[MAX_PITCH_COUNT];
+		memcpy(arrPerm, arrMultiset[iSet], n);
+		uint64_t	nPerms = gen_perm_rep_lex_count(arrPerm, n);
+		uint64_t	iPerm = 0;
+		int	nResult = gen_perm_rep_lex_init(n);
+		while (nResult == GEN_NEXT) {
+			memcpy(arrJump, arrMultiset[iSet], n);
+			if (gen_perm_rep_lex_rank(arrPerm, n) != iPerm || gen_perm_rep_lex_unrank(arrJump, n, iPerm) != GEN_NEXT
+			|| memcmp(arrJump, arrPerm, n)) {
+				printf("NG perm %d %d\n", iSet, static_cast<int>(iPerm));
+				nErrors++;
+			}
+			nResult = gen_perm_rep_lex_next(arrPerm, n);
+			iPerm++;
+		}
+		if (iPerm != nPerms || gen_perm_rep_lex_unrank(arrJump, n, nPerms) != GEN_ERROR) {
+			printf("NG perm count %d\n", iSet);
+			nErrors++;
+		}
+	}
+	static const int	arrCrawlSet[] = {0x2233, 0x354, 0x3333};
+	for (int iSet = 0; iSet < _countof(arrCrawlSet); iSet++) {	// crawler leaves
+		CCommonToneCrawler	ctc;
+		ctc.Init(arrCrawlSet[iSet]);
+		uint64_t	nLeaves = ctc.GetLeafCount();
+		for (uint64_t iLeaf = 0; iLeaf < nLeaves; iLeaf += 1 + iLeaf / 16) {
+			ctc.SetLeaf(iLeaf);
+			uint64_t	nRemain = iLeaf;
+			bool	bMatch = ctc.GetLeafIndex() == iLeaf;
+			for (int iDigit = ctc.m_nDigits - 1; iDigit >= 0; iDigit--) {
+				int	nPerms = static_cast<int>(ctc.m_arrCTPerm[iDigit].GetSize());
+				const CIntervalSet::SET&	map = ctc.m_arrCTPerm[iDigit][static_cast<int>(nRemain % nPerms)];
+				if (memcmp(map.b, m_arrToneMap[iDigit], ctc.m_arrSet.b[iDigit]))
+					bMatch = false;
+				nRemain /= nPerms;
+			}
+			if (!bMatch) {
+				printf("NG leaf %X %d\n", arrCrawlSet[iSet], static_cast<int>(iLeaf));
+				nErrors++;
+			}
+		}
+		if (ctc.SetLeaf(nLeaves)) {
+			printf("NG leaf range %X\n", arrCrawlSet[iSet]);
+			nErrors++;
+		}
+	}
+	m_bMapTones = false;
+	return !nErrors;
+}
+
 bool Main()
 {
 //	TestPitchClassSet();
 //	TestIntervalSetPacking();
 //	TestIntervalSetPermutation();
 //	TestIntervalSetForte();
+//	TestMaskClassification();
+//	MakeForteHash(_T("ForteHash.h"));
+//	TestForteHash();
+//	MakeMaskClassTable(_T("MaskClass.h"));
+//	TestMaskClassTable();
+//	TestParseProgression();
+//	TestPitchClassMask();
+//	TestIntervalVector();
+//	TestClassifyChords();
+//	TestEdoSets();
+//	TestFindHarmony();
+//	TestSetEmbedding();
+//	TestSetSimilarity();
+//	TestSetComplex();
+//	TestBoundArray();
+//	TestMaskPermutation();
+//	TestPackedIntervalSet();
+//	TestGetSpacings();
+//	TestRanking();
+//	TestSetClassEnum();
+//	TestParallelFor();
+//	TestParallelSpacing();
+//	TestDuplicateSpacings();
+//	TestMaskScoreTable();
+//	TestPrunedSpacing();
+//	TestSpacingClasses();
+//	TestSpacingRanking();
+//	TestFixedMaskPermutation();
 //	ValidateSetClasses("Wikipedia set classes.csv");
-	if (!TestHarmonizations()) return false;
+//	TestHarmonizations();
+//	MakeAliasTable(_T("AliasTable.h"));
+//	TestAliasTable();
 //	CalcOptimalSpacingAllSets();
 //	int	nSet = 0x2233;
 //	int	nSet = 0x2332;	// override = 11
@@ -1918,5 +4381,6 @@ int _tmain(int argc, _TCHAR* argv[])
 		_tprintf(_T("Fatal Error: GetModuleHandle failed\n"));
 		nRetCode = 1;
 	}
+	CThreadPool::GetPool().Shutdown();	// before static destructors run
 	return nRetCode;
 }
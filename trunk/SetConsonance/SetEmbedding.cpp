@@ -0,0 +1,68 @@
+// Copyleft 2026 Chris Korda
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation; either version 2 of the License, or any later version.
+/*
+		chris korda
+
+		revision history:
+		rev		date	comments
+		00		17oct26	initial version
+
+		count embeddings of set classes in other sets
+
+*/
+
+#include "stdafx.h"
+#include "SetEmbedding.h"
+
+CSetEmbedding::CSetEmbedding()
+{
+	m_bCreated = false;
+}
+
+void CSetEmbedding::Create()
+{
+	for (int iPrime = 0; iPrime < PRIME_FORMS; iPrime++) {
+		WORD	nPrimeMask = CPitchClassSet::GetPrimeMask(iPrime);
+		WORD	*pImage = m_arrImage[iPrime];
+		int	nImages = 0;
+		for (int iPass = 0; iPass < 2; iPass++) {
+			WORD	nMask = iPass ? CPitchClassSet::InvertMask(nPrimeMask) : nPrimeMask;
+			for (int nTranspose = 0; nTranspose < CPitchClassSet::OCTAVE; nTranspose++) {
+				WORD	nImage = CPitchClassSet::RotateMask(nMask, nTranspose);
+				int	iImage;
+				for (iImage = 0; iImage < nImages; iImage++) {	// symmetrical sets repeat images
+					if (pImage[iImage] == nImage)
+						break;
+				}
+				if (iImage == nImages)	// if distinct image
+					pImage[nImages++] = nImage;
+			}
+		}
+		m_arrImageCount[iPrime] = static_cast<BYTE>(nImages);
+		m_arrSize[iPrime] = static_cast<BYTE>(CPitchClassSet::CountBits(nPrimeMask));
+	}
+	for (int iSuper = 0; iSuper < PRIME_FORMS; iSuper++) {
+		WORD	nSuperMask = CPitchClassSet::GetPrimeMask(iSuper);
+		for (int iSub = 0; iSub < PRIME_FORMS; iSub++) {
+			int	nCount = 0;
+			if (m_arrSize[iSub] <= m_arrSize[iSuper])	// if sub is small enough to fit
+				nCount = CountEmbeddings(iSub, nSuperMask);
+			m_arrEmb[iSub][iSuper] = static_cast<BYTE>(nCount);
+		}
+	}
+	m_bCreated = true;
+}
+
+void CSetEmbedding::CountEmbeddings(WORD nSuperMask, BYTE *pCount) const
+{
+	// pCount receives EMB of each prime form in the given mask
+	int	nSuperSize = CPitchClassSet::CountBits(nSuperMask);
+	for (int iSub = 0; iSub < PRIME_FORMS; iSub++) {
+		int	nCount = 0;
+		if (m_arrSize[iSub] <= nSuperSize)	// if sub is small enough to fit
+			nCount = CountEmbeddings(iSub, nSuperMask);
+		pCount[iSub] = static_cast<BYTE>(nCount);
+	}
+}
@@ -0,0 +1,107 @@
+// Copyleft 2026 Chris Korda
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation; either version 2 of the License, or any later version.
+/*
+		chris korda
+
+		revision history:
+		rev		date	comments
+		00		17oct26	initial version
+
+		count embeddings of set classes in other sets
+
+*/
+
+#pragma once
+
+#include "PitchClassSet.h"
+
+// The embedding number EMB(X, Y) is the number of distinct transpositions
+// and inversions of set class X that are subsets of Y. Each set class has at
+// most 24 distinct images, so EMB is computed by testing each image's mask
+// against Y's mask, rather than by enumerating Y's subsets. The matrix of
+// EMB between every pair of prime forms is stored as bytes, indexed first
+// by the embedded set class and then by the embedding set class.
+
+class CSetEmbedding {
+public:
+// Constants
+	enum {
+		PRIME_FORMS = CPitchClassSet::PRIME_FORMS,
+		MAX_IMAGES = CPitchClassSet::OCTAVE * 2,	// transpositions and inversions
+	};
+
+// Construction
+	CSetEmbedding();
+	void	Create();
+
+// Attributes
+	bool	IsCreated() const;
+	int		GetImageCount(int iPrime) const;
+	WORD	GetImage(int iPrime, int iImage) const;
+	int		GetEmbeddingCount(int iSubPrime, int iSuperPrime) const;
+	bool	IsIncluded(int iSubPrime, int iSuperPrime) const;
+	const BYTE	*GetEmbeddingRow(int iSubPrime) const;
+
+// Operations
+	int		CountEmbeddings(int iSubPrime, WORD nSuperMask) const;
+	void	CountEmbeddings(WORD nSuperMask, BYTE *pCount) const;
+
+protected:
+// Data members
+	WORD	m_arrImage[PRIME_FORMS][MAX_IMAGES];	// distinct images of each prime form
+	BYTE	m_arrImageCount[PRIME_FORMS];	// number of distinct images of each prime form
+	BYTE	m_arrSize[PRIME_FORMS];	// number of pitch classes in each prime form
+	BYTE	m_arrEmb[PRIME_FORMS][PRIME_FORMS];	// EMB(sub, super), indexed by sub then super
+	bool	m_bCreated;		// true if tables are valid
+};
+
+inline bool CSetEmbedding::IsCreated() const
+{
+	return m_bCreated;
+}
+
+inline int CSetEmbedding::GetImageCount(int iPrime) const
+{
+	ASSERT(iPrime >= 0 && iPrime < PRIME_FORMS);
+	return m_arrImageCount[iPrime];
+}
+
+inline WORD CSetEmbedding::GetImage(int iPrime, int iImage) const
+{
+	ASSERT(iImage >= 0 && iImage < GetImageCount(iPrime));
+	return m_arrImage[iPrime][iImage];
+}
+
+inline int CSetEmbedding::GetEmbeddingCount(int iSubPrime, int iSuperPrime) const
+{
+	ASSERT(m_bCreated);
+	ASSERT(iSubPrime >= 0 && iSubPrime < PRIME_FORMS);
+	ASSERT(iSuperPrime >= 0 && iSuperPrime < PRIME_FORMS);
+	return m_arrEmb[iSubPrime][iSuperPrime];
+}
+
+inline bool CSetEmbedding::IsIncluded(int iSubPrime, int iSuperPrime) const
+{
+	return GetEmbeddingCount(iSubPrime, iSuperPrime) != 0;
+}
+
+inline const BYTE *CSetEmbedding::GetEmbeddingRow(int iSubPrime) const
+{
+	// returns EMB of given set class in each prime form
+	ASSERT(m_bCreated);
+	ASSERT(iSubPrime >= 0 && iSubPrime < PRIME_FORMS);
+	return m_arrEmb[iSubPrime];
+}
+
+inline int CSetEmbedding::CountEmbeddings(int iSubPrime, WORD nSuperMask) const
+{
+	ASSERT(iSubPrime >= 0 && iSubPrime < PRIME_FORMS);
+	const WORD	*pImage = m_arrImage[iSubPrime];
+	int	nImages = m_arrImageCount[iSubPrime];
+	int	nCount = 0;
+	for (int iImage = 0; iImage < nImages; iImage++)
+		nCount += (pImage[iImage] & nSuperMask) == pImage[iImage];
+	return nCount;
+}
@@ -0,0 +1,132 @@
+// Copyleft 2026 Chris Korda
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation; either version 2 of the License, or any later version.
+/*
+		chris korda
+
+		revision history:
+		rev		date	comments
+		00		17oct26	initial version
+
+		similarity measures between set classes
+
+*/
+
+#include "stdafx.h"
+#include "SetSimilarity.h"
+
+CSetSimilarity::CSetSimilarity()
+{
+	m_pOwnTables = NULL;
+	m_pTables = NULL;
+	m_hFile = INVALID_HANDLE_VALUE;
+	m_hMapping = NULL;
+	m_pView = NULL;
+}
+
+CSetSimilarity::~CSetSimilarity()
+{
+	Close();
+}
+
+void CSetSimilarity::Close()
+{
+	if (m_pView != NULL) {
+		UnmapViewOfFile(m_pView);
+		m_pView = NULL;
+	}
+	if (m_hMapping != NULL) {
+		CloseHandle(m_hMapping);
+		m_hMapping = NULL;
+	}
+	if (m_hFile != INVALID_HANDLE_VALUE) {
+		CloseHandle(m_hFile);
+		m_hFile = INVALID_HANDLE_VALUE;
+	}
+	delete m_pOwnTables;
+	m_pOwnTables = NULL;
+	m_pTables = NULL;
+}
+
+void CSetSimilarity::Create()
+{
+	Close();
+	m_pOwnTables = new TABLES;
+	WORD	arrImage[PRIME_FORMS][CPitchClassSet::OCTAVE * 2];	// transpositions and inversions
+	int	arrIntVec[PRIME_FORMS][CPitchClassSet::INTERVALS];
+	for (int iPrime = 0; iPrime < PRIME_FORMS; iPrime++) {
+		WORD	nPrimeMask = CPitchClassSet::GetPrimeMask(iPrime);
+		WORD	nInvMask = CPitchClassSet::InvertMask(nPrimeMask);
+		for (int nTranspose = 0; nTranspose < CPitchClassSet::OCTAVE; nTranspose++) {
+			arrImage[iPrime][nTranspose] = CPitchClassSet::RotateMask(nPrimeMask, nTranspose);
+			arrImage[iPrime][nTranspose + CPitchClassSet::OCTAVE] = CPitchClassSet::RotateMask(nInvMask, nTranspose);
+		}
+		CPitchClassSet::GetIntervalVector(nPrimeMask, arrIntVec[iPrime]);
+	}
+	for (int iPrime1 = 0; iPrime1 < PRIME_FORMS; iPrime1++) {
+		WORD	nMask1 = CPitchClassSet::GetPrimeMask(iPrime1);
+		for (int iPrime2 = 0; iPrime2 <= iPrime1; iPrime2++) {	// matrices are symmetric
+			int	nDist = 0;
+			for (int iInt = 0; iInt < CPitchClassSet::INTERVALS; iInt++)
+				nDist += abs(arrIntVec[iPrime1][iInt] - arrIntVec[iPrime2][iInt]);
+			int	nMaxCommon = 0;
+			const WORD	*pImage = arrImage[iPrime2];
+			for (int iImage = 0; iImage < CPitchClassSet::OCTAVE * 2; iImage++) {
+				int	nCommon = CPitchClassSet::CountBits(nMask1 & pImage[iImage]);
+				if (nCommon > nMaxCommon)
+					nMaxCommon = nCommon;
+			}
+			m_pOwnTables->arrIntervalDist[iPrime1][iPrime2] = static_cast<BYTE>(nDist);
+			m_pOwnTables->arrIntervalDist[iPrime2][iPrime1] = static_cast<BYTE>(nDist);
+			m_pOwnTables->arrCommonTones[iPrime1][iPrime2] = static_cast<BYTE>(nMaxCommon);
+			m_pOwnTables->arrCommonTones[iPrime2][iPrime1] = static_cast<BYTE>(nMaxCommon);
+		}
+	}
+	m_pTables = m_pOwnTables;
+}
+
+void CSetSimilarity::Write(LPCTSTR pszPath) const
+{
+	// throws CFileException on error
+	ASSERT(IsCreated());
+	FILE_HEADER	hdr;
+	hdr.dwSignature = FILE_SIGNATURE;
+	hdr.dwVersion = FILE_VERSION;
+	hdr.dwPrimeForms = PRIME_FORMS;
+	hdr.dwTableSize = sizeof(TABLES);
+	CFile	fOut(pszPath, CFile::modeCreate | CFile::modeWrite);
+	fOut.Write(&hdr, sizeof(hdr));
+	fOut.Write(m_pTables, sizeof(TABLES));
+}
+
+bool CSetSimilarity::Map(LPCTSTR pszPath)
+{
+	// returns false if file can't be mapped or doesn't match our format
+	Close();
+	m_hFile = CreateFile(pszPath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (m_hFile == INVALID_HANDLE_VALUE)
+		return false;
+	if (GetFileSize(m_hFile, NULL) != sizeof(FILE_HEADER) + sizeof(TABLES)) {
+		Close();
+		return false;
+	}
+	m_hMapping = CreateFileMapping(m_hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (m_hMapping == NULL) {
+		Close();
+		return false;
+	}
+	m_pView = MapViewOfFile(m_hMapping, FILE_MAP_READ, 0, 0, 0);
+	if (m_pView == NULL) {
+		Close();
+		return false;
+	}
+	const FILE_HEADER	*pHdr = static_cast<const FILE_HEADER *>(m_pView);
+	if (pHdr->dwSignature != FILE_SIGNATURE || pHdr->dwVersion != FILE_VERSION
+	|| pHdr->dwPrimeForms != PRIME_FORMS || pHdr->dwTableSize != sizeof(TABLES)) {
+		Close();
+		return false;
+	}
+	m_pTables = reinterpret_cast<const TABLES *>(pHdr + 1);
+	return true;
+}
@@ -0,0 +1,120 @@
+// Copyleft 2026 Chris Korda
+// This program is free software; you can redistribute it and/or modify it
+// under the terms of the GNU General Public License as published by the Free
+// Software Foundation; either version 2 of the License, or any later version.
+/*
+		chris korda
+
+		revision history:
+		rev		date	comments
+		00		17oct26	initial version
+
+		similarity measures between set classes
+
+*/
+
+#pragma once
+
+#include "PitchClassSet.h"
+
+// Similarity between every pair of prime forms is stored in byte matrices.
+// The interval distance is the sum of absolute differences between interval
+// vectors. The maximum common tones is the largest number of pitch classes
+// that one set can share with any transposition or inversion of the other.
+// Both measures are invariant under transposition and inversion, so masks
+// are compared by looking up their set classes; the 4096 x 4096 mask table
+// would contain nothing the prime form table doesn't.
+//
+// The tables can be written to a binary file consisting of a header followed
+// by the matrices, and the file can later be mapped into memory and used in
+// place, without reading or recomputing it.
+
+class CSetSimilarity {
+public:
+// Constants
+	enum {
+		PRIME_FORMS = CPitchClassSet::PRIME_FORMS,
+		FILE_SIGNATURE = 0x4d495353,	// "SSIM" in little-endian
+		FILE_VERSION = 1,
+	};
+
+// Types
+	struct FILE_HEADER {
+		DWORD	dwSignature;	// must be FILE_SIGNATURE
+		DWORD	dwVersion;		// must be FILE_VERSION
+		DWORD	dwPrimeForms;	// must be PRIME_FORMS
+		DWORD	dwTableSize;	// size of tables following header, in bytes
+	};
+
+// Construction
+	CSetSimilarity();
+	~CSetSimilarity();
+	void	Create();
+	bool	Map(LPCTSTR pszPath);
+	void	Write(LPCTSTR pszPath) const;
+	void	Close();
+
+// Attributes
+	bool	IsCreated() const;
+	bool	IsMapped() const;
+	int		GetIntervalDistance(int iPrime1, int iPrime2) const;
+	int		GetMaxCommonTones(int iPrime1, int iPrime2) const;
+	int		GetMaskIntervalDistance(WORD nMask1, WORD nMask2) const;
+	int		GetMaskMaxCommonTones(WORD nMask1, WORD nMask2) const;
+
+protected:
+// Types
+	struct TABLES {
+		BYTE	arrIntervalDist[PRIME_FORMS][PRIME_FORMS];	// interval vector distance
+		BYTE	arrCommonTones[PRIME_FORMS][PRIME_FORMS];	// maximum common tones under TnI
+	};
+
+// Data members
+	TABLES	*m_pOwnTables;	// tables computed by Create, if any
+	const TABLES	*m_pTables;	// current tables, either our own or a mapped view
+	HANDLE	m_hFile;		// handle of mapped file
+	HANDLE	m_hMapping;		// handle of file mapping
+	const void	*m_pView;	// mapped view of file
+
+private:
+	CSetSimilarity(const CSetSimilarity&);	// not copyable
+	CSetSimilarity& operator=(const CSetSimilarity&);
+};
+
+inline bool CSetSimilarity::IsCreated() const
+{
+	return m_pTables != NULL;
+}
+
+inline bool CSetSimilarity::IsMapped() const
+{
+	return m_pView != NULL;
+}
+
+inline int CSetSimilarity::GetIntervalDistance(int iPrime1, int iPrime2) const
+{
+	ASSERT(IsCreated());
+	ASSERT(iPrime1 >= 0 && iPrime1 < PRIME_FORMS);
+	ASSERT(iPrime2 >= 0 && iPrime2 < PRIME_FORMS);
+	return m_pTables->arrIntervalDist[iPrime1][iPrime2];
+}
+
+inline int CSetSimilarity::GetMaxCommonTones(int iPrime1, int iPrime2) const
+{
+	ASSERT(IsCreated());
+	ASSERT(iPrime1 >= 0 && iPrime1 < PRIME_FORMS);
+	ASSERT(iPrime2 >= 0 && iPrime2 < PRIME_FORMS);
+	return m_pTables->arrCommonTones[iPrime1][iPrime2];
+}
+
+inline int CSetSimilarity::GetMaskIntervalDistance(WORD nMask1, WORD nMask2) const
+{
+	// masks must not be empty
+	return GetIntervalDistance(CPitchClassSet::GetMaskClass(nMask1).iPrime, CPitchClassSet::GetMaskClass(nMask2).iPrime);
+}
+
+inline int CSetSimilarity::GetMaskMaxCommonTones(WORD nMask1, WORD nMask2) const
+{
+	// masks must not be empty
+	return GetMaxCommonTones(CPitchClassSet::GetMaskClass(nMask1).iPrime, CPitchClassSet::GetMaskClass(nMask2).iPrime);
+}
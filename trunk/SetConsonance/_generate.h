@@ -40,6 +40,12 @@ int gen_k_part_colex_next(unsigned char *vector, const unsigned char k);
 int gen_k_comp_colex_init(unsigned char *vector, const unsigned char n, const unsigned char k);
 int gen_k_comp_colex_next(unsigned char *vector, const unsigned char k);
 
+int gen_comp_weak_colex_init(unsigned char *vector, const unsigned char n, const unsigned char k);
+int gen_comp_weak_colex_next(unsigned char *vector, const unsigned char n, const unsigned char k);
+unsigned long long gen_comp_weak_colex_count(const unsigned char n, const unsigned char k);
+unsigned long long gen_comp_weak_colex_rank(const unsigned char *vector, const unsigned char n, const unsigned char k);
+int gen_comp_weak_colex_unrank(unsigned char *vector, const unsigned char n, const unsigned char k, unsigned long long rank);
+
 int gen_vari_rep_lex_init(unsigned char *vector, const unsigned char m, const unsigned char n);
 int gen_vari_rep_lex_next(unsigned char *vector, const unsigned char m, const unsigned char n);
 
@@ -51,5 +57,8 @@ int gen_neck_lex_next(unsigned char *vector, const unsigned char m, const unsign
 
 int gen_perm_rep_lex_init(const unsigned char n);
 int gen_perm_rep_lex_next(unsigned char *vector, const unsigned char n);
+unsigned long long gen_perm_rep_lex_count(const unsigned char *vector, const unsigned char n);
+unsigned long long gen_perm_rep_lex_rank(const unsigned char *vector, const unsigned char n);
+int gen_perm_rep_lex_unrank(unsigned char *vector, const unsigned char n, unsigned long long rank);
 
 #endif
@@ -0,0 +1,169 @@
+/* Copyleft 2026 Chris Korda
+This program is free software; you can redistribute it and/or modify it
+under the terms of the GNU General Public License as published by the Free
+Software Foundation; either version 2 of the License, or any later version.
+
+revision history:
+rev		date	comments
+00		17oct26	initial version
+01		17oct26	add ranking and unranking
+
+Weak compositions of at most n into k parts in colexicographic order
+
+Written in the style of the other generation functions declared in _generate.h.
+The figures are the k-tuples whose elements sum to at most n, in the same order
+as counting through all k-tuples over the alphabet 0..n with the first element
+changing fastest, but skipping tuples whose sum exceeds n.
+
+Functions:
+  int gen_comp_weak_colex_init(unsigned char *vector, const unsigned char n, const unsigned char k)
+    Test for special cases
+    Initialization of vector
+    Possible return values are: GEN_EMPTY, GEN_NEXT
+
+  int gen_comp_weak_colex_next(unsigned char *vector, const unsigned char n, const unsigned char k)
+    Transforms current figure in vector into its successor
+    Possible return values are: GEN_NEXT, GEN_TERM
+
+  unsigned long long gen_comp_weak_colex_count(const unsigned char n, const unsigned char k)
+    Returns the number of figures
+
+  unsigned long long gen_comp_weak_colex_rank(const unsigned char *vector, const unsigned char n, const unsigned char k)
+    Returns the position of the figure in vector, counting from zero
+
+  int gen_comp_weak_colex_unrank(unsigned char *vector, const unsigned char n, const unsigned char k, unsigned long long rank)
+    Stores the figure at the given position in vector
+    Possible return values are: GEN_NEXT, GEN_ERROR
+
+Arguments:
+  unsigned char *vector; //pointer to the array where the current figure is stored
+  const unsigned char n; //maximum sum of elements
+  const unsigned char k; //length of figures
+  unsigned long long rank; //position of a figure, counting from zero
+
+Usage and restrictions:
+  Arguments and elements in vector are restricted to the interval (0, 255)
+  Memory allocation for vector must be provided by the calling process
+
+Cardinality:
+  (n + k)! / (n! * k!)
+*/
+
+#include "_generate.h"
+
+int gen_comp_weak_colex_init(unsigned char *vector, const unsigned char n, const unsigned char k)
+{
+int j; //index
+
+(void)n; //any n admits the all-zero figure
+
+//test for special cases
+if(k == 0)
+ return(GEN_EMPTY);
+
+//initialize: all elements zero
+for(j = 0; j < k; j++)
+ vector[j] = 0;
+
+return(GEN_NEXT);
+}
+
+int gen_comp_weak_colex_next(unsigned char *vector, const unsigned char n, const unsigned char k)
+{
+int j;       //index
+int sum = 0; //sum of elements from index j onward
+
+for(j = 0; j < k; j++)
+ sum += vector[j];
+
+//find leftmost element that can be increased after zeroing all elements to its left
+for(j = 0; j < k; j++)
+ {
+ if(sum < n)
+  break;
+
+ sum -= vector[j];
+ }
+
+//terminate if no element can be increased
+if(j >= k)
+ return(GEN_TERM);
+
+//increase
+vector[j]++;
+
+//zero left-hand elements
+while(--j >= 0)
+ vector[j] = 0;
+
+return(GEN_NEXT);
+}
+
+//number of ways to choose b items from a
+static unsigned long long comp_weak_colex_binomial(int a, int b)
+{
+unsigned long long x = 1; //result
+int j;                    //index
+
+if(b < 0 || b > a)
+ return(0);
+
+for(j = 1; j <= b; j++)
+ x = x * (a - b + j) / j;
+
+return(x);
+}
+
+unsigned long long gen_comp_weak_colex_count(const unsigned char n, const unsigned char k)
+{
+//number of k-tuples with sum at most n
+return(comp_weak_colex_binomial(n + k, k));
+}
+
+unsigned long long gen_comp_weak_colex_rank(const unsigned char *vector, const unsigned char n, const unsigned char k)
+{
+unsigned long long rank = 0; //result
+int left = n;                //sum still available for elements left of j
+int j;                       //index
+int t;                       //value
+
+//for each element from the most significant, count the figures that have
+//a smaller value at that position and the same values to the right of it
+for(j = k - 1; j >= 0; j--)
+ {
+ for(t = 0; t < vector[j]; t++)
+  rank += comp_weak_colex_binomial(left - t + j, j);
+
+ left -= vector[j];
+ }
+
+return(rank);
+}
+
+int gen_comp_weak_colex_unrank(unsigned char *vector, const unsigned char n, const unsigned char k, unsigned long long rank)
+{
+int left = n;             //sum still available for elements left of j
+int j;                    //index
+unsigned long long count; //number of figures with given value at position j
+
+if(rank >= gen_comp_weak_colex_count(n, k))
+ return(GEN_ERROR);
+
+for(j = k - 1; j >= 0; j--)
+ {
+ vector[j] = 0;
+ for(;;)
+  {
+  count = comp_weak_colex_binomial(left - vector[j] + j, j);
+  if(rank < count)
+   break;
+
+  rank -= count;
+  vector[j]++;
+  }
+
+ left -= vector[j];
+ }
+
+return(GEN_NEXT);
+}
@@ -0,0 +1,94 @@
+/* Copyleft 2026 Chris Korda
+This program is free software; you can redistribute it and/or modify it
+under the terms of the GNU General Public License as published by the Free
+Software Foundation; either version 2 of the License, or any later version.
+
+revision history:
+rev		date	comments
+00		17oct26	initial version
+
+Necklaces in lexicographic order
+
+Written in the style of the other generation functions declared in _generate.h.
+A necklace is the lexicographically smallest of the n rotations of a figure, so
+each equivalence class of figures under rotation is generated exactly once.
+
+Based on the FKM algorithm in: Fredricksen, Harold; Kessler, Irving J.; Maiorana,
+James A.: Necklaces and de Bruijn sequences. Discrete Mathematics 23, 1978; see
+also Ruskey, Frank; Savage, Carla; Wang, Terry: Generating necklaces. Journal of
+Algorithms 13, 1992. The successor of a prenecklace is found by incrementing its
+rightmost element that is less than m - 1, and repeating the new prefix to fill
+the figure; the result is a necklace if and only if the length of the prefix
+divides n. Prenecklaces that aren't necklaces are skipped, which costs constant
+amortized time per necklace.
+
+Functions:
+  int gen_neck_lex_init(unsigned char *vector, const unsigned char m, const unsigned char n)
+    Test for special cases
+    Initialization of vector
+    Possible return values are: GEN_EMPTY, GEN_NEXT
+
+  int gen_neck_lex_next(unsigned char *vector, const unsigned char m, const unsigned char n)
+    Transforms current figure in vector into its successor
+    Possible return values are: GEN_NEXT, GEN_TERM
+
+Arguments:
+  unsigned char *vector; //pointer to the array where the current figure is stored
+  const unsigned char m; //length of alphabet
+  const unsigned char n; //length of figures
+
+Usage and restrictions:
+  Arguments and elements in vector are restricted to the interval (0, 255)
+  Memory allocation for vector must be provided by the calling process
+
+Cardinality:
+  (1 / n) * sum of phi(d) * m^(n / d) over all divisors d of n, where phi is Euler's totient
+*/
+
+#include "_generate.h"
+
+int gen_neck_lex_init(unsigned char *vector, const unsigned char m, const unsigned char n)
+{
+int j; //index
+
+//test for special cases
+if(m == 0 || n == 0)
+ return(GEN_EMPTY);
+
+//initialize: the first necklace is all zeros
+for(j = 0; j < n; j++)
+ vector[j] = 0;
+
+return(GEN_NEXT);
+}
+
+int gen_neck_lex_next(unsigned char *vector, const unsigned char m, const unsigned char n)
+{
+int i; //index
+int j; //help index
+int p; //length of repeated prefix
+
+do
+ {
+ //find rightmost element to increase
+ i = n - 1;
+ while(i >= 0 && vector[i] == m - 1)
+  i--;
+
+ //terminate if all elements are m - 1
+ if(i < 0)
+  return(GEN_TERM);
+
+ //increase
+ vector[i]++;
+
+ //repeat prefix
+ p = i + 1;
+ for(j = p; j < n; j++)
+  vector[j] = vector[j - p];
+ }
+//skip prenecklaces that aren't necklaces
+while(n % p != 0);
+
+return(GEN_NEXT);
+}
@@ -0,0 +1,128 @@
+/* Copyleft 2026 Chris Korda
+This program is free software; you can redistribute it and/or modify it
+under the terms of the GNU General Public License as published by the Free
+Software Foundation; either version 2 of the License, or any later version.
+
+revision history:
+rev		date	comments
+00		17oct26	initial version
+
+Ranking and unranking of permutations with repetition in lexicographic order
+
+Companion to perm_rep_lex.c: the rank of a figure is the number of times
+gen_perm_rep_lex_next must be called to reach it, starting from the elements
+arranged in increasing order, so a caller can jump directly to any figure.
+
+Functions:
+  unsigned long long gen_perm_rep_lex_count(const unsigned char *vector, const unsigned char n)
+    Returns the number of distinct permutations of the elements in vector
+
+  unsigned long long gen_perm_rep_lex_rank(const unsigned char *vector, const unsigned char n)
+    Returns the position of the figure in vector, counting from zero
+
+  int gen_perm_rep_lex_unrank(unsigned char *vector, const unsigned char n, unsigned long long rank)
+    Rearranges the elements in vector into the figure at the given position
+    Possible return values are: GEN_NEXT, GEN_EMPTY, GEN_ERROR
+
+Arguments:
+  unsigned char *vector; //pointer to the array where the current figure is stored
+  const unsigned char n; //length of alphabet
+  unsigned long long rank; //position of a figure, counting from zero
+
+Usage and restrictions:
+  Arguments and elements in vector are restricted to the interval (0, 255)
+  Intermediate products must fit in unsigned long long, which holds for n <= 19
+  For unranking, vector may contain the elements in any order
+*/
+
+#include "_generate.h"
+
+//element counts and number of permutations of the remaining elements
+static unsigned long long perm_rep_lex_count_elements(const unsigned char *vector, const unsigned char n, unsigned char *count)
+{
+unsigned long long perms = 1; //result
+int j;                        //index
+
+for(j = 0; j < 256; j++)
+ count[j] = 0;
+
+//multiply by remaining positions and divide by multiplicity as each element is placed
+for(j = 0; j < n; j++)
+ {
+ count[vector[j]]++;
+ perms = perms * (j + 1) / count[vector[j]];
+ }
+
+return(perms);
+}
+
+unsigned long long gen_perm_rep_lex_count(const unsigned char *vector, const unsigned char n)
+{
+unsigned char count[256]; //number of occurrences of each element
+
+return(perm_rep_lex_count_elements(vector, n, count));
+}
+
+unsigned long long gen_perm_rep_lex_rank(const unsigned char *vector, const unsigned char n)
+{
+unsigned char count[256];    //number of occurrences of each remaining element
+unsigned long long perms;    //number of permutations of remaining elements
+unsigned long long rank = 0; //result
+int j;                       //index
+int t;                       //element
+
+perms = perm_rep_lex_count_elements(vector, n, count);
+
+//for each position, count the figures that have a smaller element there
+for(j = 0; j < n; j++)
+ {
+ for(t = 0; t < vector[j]; t++)
+  {
+  if(count[t])
+   rank += perms * count[t] / (n - j);
+  }
+
+ perms = perms * count[vector[j]] / (n - j);
+ count[vector[j]]--;
+ }
+
+return(rank);
+}
+
+int gen_perm_rep_lex_unrank(unsigned char *vector, const unsigned char n, unsigned long long rank)
+{
+unsigned char count[256];         //number of occurrences of each remaining element
+unsigned long long perms;         //number of permutations of remaining elements
+unsigned long long perms_element; //number of permutations starting with element t
+int j;                            //index
+int t;                            //element
+
+//test for special cases
+if(n == 0)
+ return(GEN_EMPTY);
+
+perms = perm_rep_lex_count_elements(vector, n, count);
+if(rank >= perms)
+ return(GEN_ERROR);
+
+for(j = 0; j < n; j++)
+ {
+ for(t = 0; ; t++)
+  {
+  if(!count[t])
+   continue;
+
+  perms_element = perms * count[t] / (n - j);
+  if(rank < perms_element)
+   break;
+
+  rank -= perms_element;
+  }
+
+ vector[j] = (unsigned char)t;
+ perms = perms_element;
+ count[t]--;
+ }
+
+return(GEN_NEXT);
+}